@@ -0,0 +1,22 @@
+if(TARGET benchmark::benchmark_main)
+  return()
+endif()
+
+find_package(benchmark QUIET)
+if(benchmark_FOUND)
+  return()
+endif()
+
+include(FetchContent)
+FetchContent_Declare(
+  benchmark
+  GIT_REPOSITORY https://github.com/google/benchmark.git
+  GIT_TAG v1.7.1
+  GIT_SHALLOW TRUE
+  GIT_PROGRESS TRUE
+)
+
+set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+
+FetchContent_MakeAvailable(benchmark)
@@ -1,2 +1,10 @@
 import sapien
 from pysapien_render_server import *
+import os
+
+# reduced pipelines picked by cameras that declare only these render targets
+_shader_root = os.path.join(os.path.dirname(__file__), "shaders")
+RenderServer._set_target_shader_dir(["depth"], os.path.join(_shader_root, "depth"))
+RenderServer._set_target_shader_dir(
+    ["segmentation", "depth"], os.path.join(_shader_root, "segmentation")
+)
@@ -0,0 +1,16 @@
+#version 450
+
+layout(set = 1, binding = 0) uniform ObjectBuffer {
+  mat4 modelMatrix;
+  mat4 prevModelMatrix;
+  uvec4 segmentation;
+  float transparency;
+  int shadeFlat;
+} objectBuffer;
+
+void main() {
+  // fully transparent objects are hidden, as in the default pack
+  if (objectBuffer.transparency >= 1.f) {
+    discard;
+  }
+}
@@ -0,0 +1,18 @@
+#version 450
+
+layout(set = 1, binding = 0) uniform ObjectBuffer {
+  mat4 modelMatrix;
+  mat4 prevModelMatrix;
+  uvec4 segmentation;
+  float transparency;
+  int shadeFlat;
+} objectBuffer;
+
+layout(location = 0) out uvec4 outSegmentation;
+
+void main() {
+  if (objectBuffer.transparency >= 1.f) {
+    discard;
+  }
+  outSegmentation = objectBuffer.segmentation;
+}
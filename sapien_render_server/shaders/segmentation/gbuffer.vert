@@ -0,0 +1,36 @@
+#version 450
+
+// ID-only pack: the gbuffer pass writes the mesh and actor ids (Segmentation) and its depth
+// attachment, there are no lighting, shadow or composite passes.
+
+layout(set = 0, binding = 0) uniform CameraBuffer {
+  mat4 viewMatrix;
+  mat4 projectionMatrix;
+  mat4 viewMatrixInverse;
+  mat4 projectionMatrixInverse;
+  mat4 prevViewMatrix;
+  mat4 prevViewMatrixInverse;
+  float width;
+  float height;
+} cameraBuffer;
+
+layout(set = 1, binding = 0) uniform ObjectBuffer {
+  mat4 modelMatrix;
+  mat4 prevModelMatrix;
+  uvec4 segmentation;
+  float transparency;
+  int shadeFlat;
+} objectBuffer;
+
+// the vertex layout is shared by all packs of a renderer, so it matches the default pack
+layout(location = 0) in vec3 position;
+layout(location = 1) in vec3 normal;
+layout(location = 2) in vec2 uv;
+layout(location = 3) in vec3 tangent;
+layout(location = 4) in vec3 bitangent;
+layout(location = 5) in vec4 color;
+
+void main() {
+  gl_Position = cameraBuffer.projectionMatrix * cameraBuffer.viewMatrix *
+                objectBuffer.modelMatrix * vec4(position, 1.f);
+}
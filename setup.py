@@ -76,6 +76,7 @@ setup(
     version="0.1",
     python_requires=">=3.7",
     packages=["sapien_render_server"],
+    package_data={"sapien_render_server": ["shaders/*/*"]},
     ext_modules=[CMakeExtension("sapien_render_server")],
     cmdclass={"build_ext": CMakeBuild},
     install_requires=["sapien"],
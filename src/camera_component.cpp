@@ -6,8 +6,9 @@ namespace sapien {
 namespace render_server {
 
 ClientCameraComponent::ClientCameraComponent(uint32_t width, uint32_t height,
-                                             std::string const &shaderDir)
-    : mWidth(width), mHeight(height), mShaderDir(shaderDir) {
+                                             std::string const &shaderDir,
+                                             std::vector<std::string> const &renderTargets)
+    : mWidth(width), mHeight(height), mShaderDir(shaderDir), mRenderTargets(renderTargets) {
   mFx = mFy = height / 2.f / std::tan(std::numbers::pi_v<float> / 4.f);
   mCx = width / 2.f;
   mCy = height / 2.f;
@@ -33,6 +34,9 @@ void ClientCameraComponent::onAddToScene(Scene &scene) {
     req.set_cx(mCx);
     req.set_cy(mCy);
     req.set_shader(mShaderDir);
+    for (auto const &target : mRenderTargets) {
+      req.add_render_targets(target);
+    }
 
     auto status = system->getStub().AddCamera(&context, req, &res);
     if (!status.ok()) {
@@ -2,13 +2,18 @@
 #include "proto/render_server.grpc.pb.h"
 #include <numbers>
 #include <sapien/component.h>
+#include <vector>
 
 namespace sapien {
 namespace render_server {
 
 class ClientCameraComponent : public Component {
 public:
-  ClientCameraComponent(uint32_t width, uint32_t height, std::string const &shaderDir);
+  // renderTargets limits the camera to these targets (names as in
+  // RenderServer::autoAllocateBuffers, without type), so the server can render it with a smaller
+  // pipeline; empty renders all
+  ClientCameraComponent(uint32_t width, uint32_t height, std::string const &shaderDir,
+                        std::vector<std::string> const &renderTargets = {});
 
   void onAddToScene(Scene &scene) override;
   void onRemoveFromScene(Scene &scene) override;
@@ -27,6 +32,7 @@ private:
   float mWidth;
   float mHeight;
   std::string mShaderDir;
+  std::vector<std::string> mRenderTargets;
 
   float mNear;
   float mFar;
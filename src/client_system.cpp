@@ -1,13 +1,34 @@
 #include "client_system.h"
 #include "camera_component.h"
+#include "pose_compose.h"
 #include "render_body_component.h"
+#include "update_request.h"
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <pybind11/pybind11.h>
+#include <unistd.h>
 
 namespace sapien {
 namespace render_server {
 using ::grpc::ClientContext;
 using ::grpc::Status;
 
-ClientSystem::ClientSystem(std::string const &address, uint64_t index) : mIndex(index) {
+ClientSystem::ClientSystem(std::string const &address, uint64_t index, bool sharedMemory,
+                           bool stream, bool quantizePoses, Vec3 const &poseOrigin,
+                           float positionStep)
+    : mIndex(index), mUseSharedMemory(sharedMemory), mQuantizePoses(quantizePoses),
+      mUseStream(stream) {
+  mUpdateRenderReq = google::protobuf::Arena::CreateMessage<proto::UpdateRenderReq>(&mArena);
+  mUpdateRenderAndTakePicturesReq =
+      google::protobuf::Arena::CreateMessage<proto::UpdateRenderAndTakePicturesReq>(&mArena);
+  mStepReq = google::protobuf::Arena::CreateMessage<proto::StepReq>(&mArena);
+
+  mPoseQuantization.origin[0] = poseOrigin.x;
+  mPoseQuantization.origin[1] = poseOrigin.y;
+  mPoseQuantization.origin[2] = poseOrigin.z;
+  mPoseQuantization.positionStep = positionStep;
+
   grpc::ChannelArguments args;
   args.SetLoadBalancingPolicyName("round_robin");
   mChannel = CreateCustomChannel(address, grpc::InsecureChannelCredentials(), args);
@@ -18,11 +39,19 @@ ClientSystem::ClientSystem(std::string const &address, uint64_t index) : mIndex(
   proto::Id res;
 
   req.set_index(mIndex);
+  if (mQuantizePoses) {
+    req.set_pose_encoding(proto::POSE_QUANTIZED);
+    req.mutable_pose_origin()->set_x(poseOrigin.x);
+    req.mutable_pose_origin()->set_y(poseOrigin.y);
+    req.mutable_pose_origin()->set_z(poseOrigin.z);
+    req.set_position_step(positionStep);
+  }
 
   Status status = mStub->CreateScene(&context, req, &res);
   if (!status.ok()) {
     throw std::runtime_error(status.error_message());
   }
+  mServerId = res.id();
 }
 
 void ClientSystem::registerCamera(std::shared_ptr<ClientCameraComponent> camera) {
@@ -109,129 +138,594 @@ void ClientSystem::addDirectionalLight(Vec3 const &direction, Vec3 const &color,
   // res.id()
 }
 
+static inline void writePose(float *out, Pose const &pose) {
+  out[0] = pose.p.x;
+  out[1] = pose.p.y;
+  out[2] = pose.p.z;
+  out[3] = pose.q.w;
+  out[4] = pose.q.x;
+  out[5] = pose.q.y;
+  out[6] = pose.q.z;
+}
+
 void ClientSystem::syncId() {
   if (mIdSynced) {
     return;
   }
-  grpc::ClientContext context;
+  // queued updates use the current order and pose buffer
+  fence();
+
   proto::EntityOrderReq req;
   proto::Empty res;
   req.set_scene_id(mServerId);
-  for (auto &body : mRenderBodies) {
-    for (auto &shape : body->getRenderShapes()) {
+  mShapeCount = 0;
+  mShapeBodyIndices.clear();
+  mShapeLocalPoses.clear();
+  for (uint32_t b = 0; b < mRenderBodies.size(); ++b) {
+    for (auto &shape : mRenderBodies[b]->getRenderShapes()) {
       req.add_body_ids(shape->getServerId());
+      mShapeCount++;
+
+      mShapeBodyIndices.push_back(b);
+      mShapeLocalPoses.resize(mShapeLocalPoses.size() + 7);
+      writePose(mShapeLocalPoses.data() + mShapeLocalPoses.size() - 7, shape->getLocalPose());
     }
   }
   for (auto &cam : mCameras) {
     req.add_camera_ids(cam->getServerId());
   }
 
+  std::unique_ptr<SharedPoseBuffer> poseBuffer;
+  if (mUseSharedMemory) {
+    uint32_t slots = std::max(kPoseBufferSlots, mMaxStepsInFlight + 1);
+    std::string name = "/sapien_render_" + std::to_string(getpid()) + "_" +
+                       std::to_string(mServerId) + "_" + std::to_string(mPoseBufferVersion++);
+    try {
+      poseBuffer =
+          SharedPoseBuffer::Create(name, slots, 7 * (mShapeCount + mCameras.size()));
+      req.set_pose_buffer_name(name);
+      req.set_pose_buffer_slots(slots);
+    } catch (std::exception const &) {
+      mUseSharedMemory = false;
+    }
+  }
+
+  grpc::ClientContext context;
   Status status = getStub().SetEntityOrder(&context, req, &res);
+  if (!status.ok() && poseBuffer) {
+    // the server cannot map our memory (e.g. it runs on another host), send poses in requests
+    mUseSharedMemory = false;
+    poseBuffer.reset();
+    req.clear_pose_buffer_name();
+    req.clear_pose_buffer_slots();
+
+    grpc::ClientContext retryContext;
+    status = getStub().SetEntityOrder(&retryContext, req, &res);
+  }
   if (!status.ok()) {
     throw std::runtime_error("failed to sync id: " + status.error_message());
   }
+
+  // the server holds its own mapping now, so the name is no longer needed
+  if (poseBuffer) {
+    poseBuffer->unlink();
+  }
+  mPoseBuffer = std::move(poseBuffer);
+  resetSentPoses();
   mIdSynced = true;
 }
 
-void ClientSystem::step() {
-  syncId();
+void ClientSystem::writePoses(float *bodyPoses, float *cameraPoses) {
+  if (bodyPoses && mBodyPoseInput) {
+    composeShapePoses(mBodyPoseInput, mShapeBodyIndices.data(), mShapeLocalPoses.data(),
+                      mShapeCount, bodyPoses);
+  } else if (bodyPoses) {
+    for (auto &body : mRenderBodies) {
+      auto b2w = body->getPose();
+      for (auto &shape : body->getRenderShapes()) {
+        writePose(bodyPoses, b2w * shape->getLocalPose());
+        bodyPoses += 7;
+      }
+    }
+  }
 
-  grpc::ClientContext context;
-  proto::UpdateRenderReq req;
-  proto::Empty res;
+  for (auto &cam : mCameras) {
+    writePose(cameraPoses, cam->getPose() * cam->getLocalPose());
+    cameraPoses += 7;
+  }
+}
 
-  req.set_scene_id(mServerId);
+template <typename Req> void ClientSystem::fillPoses(Req &req) {
+  uint64_t frame = ++mFrame;
+  if (mPoseBuffer) {
+    uint32_t slot = frame % mPoseBuffer->getSlotCount();
+    float *poses = mPoseBuffer->getMutableSlot(slot);
+    writePoses(poses, poses + 7 * mShapeCount);
+    mPoseBuffer->publish(slot, frame);
+
+    req.mutable_pose_slot()->set_frame(frame);
+    req.mutable_pose_slot()->set_slot(slot);
+    return;
+  }
+
+  if (mDeltaPoses) {
+    fillDeltaPoses(*req.mutable_body_pose_indices(), *req.mutable_body_pose_data());
+    req.mutable_camera_pose_data()->Resize(mCameras.size() * 7, 0.f);
+    writePoses(nullptr, req.mutable_camera_pose_data()->mutable_data());
+    return;
+  }
+
+  if (mQuantizePoses) {
+    size_t cameraCount = mCameras.size();
+    mPoseScratch.resize(7 * (mShapeCount + cameraCount));
+    writePoses(mPoseScratch.data(), mPoseScratch.data() + 7 * mShapeCount);
+
+    auto bodyData = req.mutable_body_pose_quantized();
+    bodyData->resize(getQuantizedPosesSize(mShapeCount));
+    encodePoses(mPoseScratch.data(), mShapeCount, mPoseQuantization,
+                reinterpret_cast<uint8_t *>(bodyData->data()));
+
+    auto cameraData = req.mutable_camera_pose_quantized();
+    cameraData->resize(getQuantizedPosesSize(cameraCount));
+    encodePoses(mPoseScratch.data() + 7 * mShapeCount, cameraCount, mPoseQuantization,
+                reinterpret_cast<uint8_t *>(cameraData->data()));
+    return;
+  }
+
+  req.mutable_body_pose_data()->Resize(mShapeCount * 7, 0.f);
+  req.mutable_camera_pose_data()->Resize(mCameras.size() * 7, 0.f);
+  writePoses(req.mutable_body_pose_data()->mutable_data(),
+             req.mutable_camera_pose_data()->mutable_data());
+}
+
+void ClientSystem::fillDeltaPoses(google::protobuf::RepeatedField<uint32_t> &indices,
+                                  google::protobuf::RepeatedField<float> &data) {
+  if (mSentPoses.size() != mShapeCount) {
+    resetSentPoses();
+  }
+
+  if (mBodyPoseInput) {
+    mPoseScratch.resize(7 * mShapeCount);
+    composeShapePoses(mBodyPoseInput, mShapeBodyIndices.data(), mShapeLocalPoses.data(),
+                      mShapeCount, mPoseScratch.data());
+  }
+
+  uint32_t index = 0;
   for (auto &body : mRenderBodies) {
-    auto b2w = body->getPose();
-    for (auto &shape : body->getRenderShapes()) {
-      auto s2b = shape->getLocalPose();
-      auto pose = b2w * s2b;
-      auto p = req.add_body_poses();
-      p->mutable_p()->set_x(pose.p.x);
-      p->mutable_p()->set_y(pose.p.y);
-      p->mutable_p()->set_z(pose.p.z);
-
-      p->mutable_q()->set_w(pose.q.w);
-      p->mutable_q()->set_x(pose.q.x);
-      p->mutable_q()->set_y(pose.q.y);
-      p->mutable_q()->set_z(pose.q.z);
+    auto &shapes = body->getRenderShapes();
+    // NaN marks a pose that has not been sent
+    if (body->isStatic() && !shapes.empty() && !std::isnan(mSentPoses[index][0])) {
+      index += shapes.size();
+      continue;
+    }
+
+    auto b2w = mBodyPoseInput ? Pose() : body->getPose();
+    for (auto &shape : shapes) {
+      std::array<float, 7> pose;
+      if (mBodyPoseInput) {
+        std::copy_n(mPoseScratch.data() + 7 * index, 7, pose.data());
+      } else {
+        writePose(pose.data(), b2w * shape->getLocalPose());
+      }
+
+      auto &sent = mSentPoses[index];
+      bool changed = false;
+      for (int i = 0; i < 7; ++i) {
+        // also true when sent is NaN
+        changed |= !(std::fabs(pose[i] - sent[i]) <= mDeltaEpsilon);
+      }
+      if (changed) {
+        sent = pose;
+        indices.Add(index);
+        data.Add(pose.begin(), pose.end());
+      }
+      index++;
     }
   }
+}
 
-  for (auto &cam : mCameras) {
-    auto pose = cam->getPose() * cam->getLocalPose();
+void ClientSystem::resetSentPoses() {
+  mSentPoses.assign(mShapeCount, {NAN, NAN, NAN, NAN, NAN, NAN, NAN});
+}
+
+void ClientSystem::setDeltaPoses(bool enabled, float epsilon) {
+  mDeltaPoses = enabled;
+  mDeltaEpsilon = epsilon;
+  resetSentPoses();
+}
+
+void ClientSystem::sendStep(proto::StepReq &req) {
+  req.set_frame(mFrame);
+  if (!mStepStream) {
+    mStepContext = std::make_unique<grpc::ClientContext>();
+    mStepStream = getStub().StepStream(mStepContext.get());
+    if (mMaxStepsInFlight) {
+      mAckThread = std::thread(&ClientSystem::readStepAcks, this);
+    }
+  }
+  if (mMaxStepsInFlight) {
+    sendStepPipelined(req);
+    return;
+  }
 
-    auto p = req.add_camera_poses();
-    p->mutable_p()->set_x(pose.p.x);
-    p->mutable_p()->set_y(pose.p.y);
-    p->mutable_p()->set_z(pose.p.z);
+  proto::StepAck ack;
+  if (!mStepStream->Write(req) || !mStepStream->Read(&ack)) {
+    resetSentPoses();
+    Status status = mStepStream->Finish();
+    mStepStream.reset();
+    mStepContext.reset();
+    throw std::runtime_error("step stream closed: " + status.error_message());
+  }
+  if (!ack.ok()) {
+    resetSentPoses();
+    throw std::runtime_error("failed to step: " + ack.error());
+  }
+  if (ack.frame() != req.frame()) {
+    throw std::runtime_error("failed to step: acknowledged frame does not match");
+  }
+}
+
+void ClientSystem::sendStepPipelined(proto::StepReq &req) {
+  {
+    std::unique_lock lock(mAckMutex);
+    mAckCondition.wait(lock, [this] {
+      return mStepsInFlight < mMaxStepsInFlight || !mStepError.empty();
+    });
+    if (!mStepError.empty()) {
+      lock.unlock();
+      throwStepError();
+    }
+    mStepsInFlight++;
+  }
+
+  if (!mStepStream->Write(req)) {
+    {
+      std::lock_guard lock(mAckMutex);
+      if (mStepError.empty()) {
+        mStepError = "step stream closed";
+      }
+    }
+    throwStepError();
+  }
+}
+
+void ClientSystem::readStepAcks() {
+  proto::StepAck ack;
+  while (mStepStream->Read(&ack)) {
+    std::lock_guard lock(mAckMutex);
+    if (!ack.ok() && mStepError.empty()) {
+      mStepError = "frame " + std::to_string(ack.frame()) + ": " + ack.error();
+    }
+    mAckedFrame = ack.frame();
+    mStepsInFlight--;
+    mAckCondition.notify_all();
+  }
 
-    p->mutable_q()->set_w(pose.q.w);
-    p->mutable_q()->set_x(pose.q.x);
-    p->mutable_q()->set_y(pose.q.y);
-    p->mutable_q()->set_z(pose.q.z);
+  std::lock_guard lock(mAckMutex);
+  if (mStepsInFlight && mStepError.empty()) {
+    mStepError = "step stream closed";
   }
+  mAckCondition.notify_all();
+}
+
+void ClientSystem::throwStepError() {
+  std::string error;
+  {
+    std::lock_guard lock(mAckMutex);
+    error = std::move(mStepError);
+    mStepError.clear();
+  }
+
+  // updates after the failed one may have been applied or not, start over with a new stream
+  mStepContext->TryCancel();
+  if (mAckThread.joinable()) {
+    mAckThread.join();
+  }
+  mStepStream->Finish();
+  mStepStream.reset();
+  mStepContext.reset();
+  mStepsInFlight = 0;
+  resetSentPoses();
+  throw std::runtime_error("failed to step: " + error);
+}
+
+void ClientSystem::wait(uint64_t ticket) {
+  waitAsync();
+  if (!mAckThread.joinable()) {
+    return;
+  }
+  {
+    std::unique_lock lock(mAckMutex);
+    mAckCondition.wait(lock, [this, ticket] {
+      return mStepsInFlight == 0 || mAckedFrame >= ticket || !mStepError.empty();
+    });
+    if (mStepError.empty()) {
+      return;
+    }
+  }
+  throwStepError();
+}
+
+void ClientSystem::setMaxStepsInFlight(uint32_t maxInFlight) {
+  waitAsync();
+  if (maxInFlight == mMaxStepsInFlight) {
+    return;
+  }
+  closeStepStream();
+  mMaxStepsInFlight = maxInFlight;
+  // the pose buffer may need more slots
+  if (mUseSharedMemory || mPoseBuffer) {
+    mIdSynced = false;
+  }
+}
+
+void ClientSystem::closeStepStream() {
+  if (!mStepStream) {
+    return;
+  }
+  mStepStream->WritesDone();
+  // the server applies the queued updates before it ends the stream
+  if (mAckThread.joinable()) {
+    mAckThread.join();
+  }
+  mStepStream->Finish();
+  mStepStream.reset();
+  mStepContext.reset();
+  mStepsInFlight = 0;
+  mStepError.clear();
+}
 
-  Status status = getStub().UpdateRender(&context, req, &res);
+void ClientSystem::fillStepRequest() {
+  syncId();
+
+  if (mUseStream || mMaxStepsInFlight) {
+    auto &req = *mStepReq;
+    clearStepRequest(req, mPoseBuffer != nullptr);
+    req.mutable_update()->set_scene_id(mServerId);
+    fillPoses(*req.mutable_update());
+    return;
+  }
+
+  auto &req = *mUpdateRenderReq;
+  clearUpdateRequest(req, mPoseBuffer != nullptr);
+  req.set_scene_id(mServerId);
+  fillPoses(req);
+}
+
+void ClientSystem::sendStepRequest() {
+  if (mUseStream || mMaxStepsInFlight) {
+    sendStep(*mStepReq);
+    return;
+  }
+
+  grpc::ClientContext context;
+  proto::Empty res;
+  Status status = getStub().UpdateRender(&context, *mUpdateRenderReq, &res);
   if (!status.ok()) {
+    resetSentPoses();
     throw std::runtime_error("failed to update render" + status.error_message());
   }
 }
 
-void ClientSystem::updateRenderAndTakePictures(
+void ClientSystem::step() {
+  // an async call may still be sending the reused request
+  waitAsync();
+  fillStepRequest();
+  sendStepRequest();
+}
+
+void ClientSystem::fillUpdate(proto::UpdateRenderAndTakePicturesReq &req,
+                              std::vector<std::shared_ptr<ClientCameraComponent>> const &cameras) {
+  syncId();
+
+  req.set_scene_id(mServerId);
+  fillPoses(req);
+
+  for (auto cam : cameras) {
+    req.add_camera_ids(cam->getServerId());
+  }
+}
+
+void ClientSystem::fillRenderRequest(
     std::vector<std::shared_ptr<ClientCameraComponent>> const &cameras) {
+  // the pose buffer is settled before clearing decides whether pose_slot is kept
   syncId();
 
+  if (mUseStream || mMaxStepsInFlight) {
+    auto &req = *mStepReq;
+    clearStepRequest(req, mPoseBuffer != nullptr);
+    fillUpdate(*req.mutable_update(), cameras);
+    return;
+  }
+
+  auto &req = *mUpdateRenderAndTakePicturesReq;
+  clearUpdateRequest(req, mPoseBuffer != nullptr);
+  fillUpdate(req, cameras);
+}
+
+void ClientSystem::sendRenderRequest() {
+  if (mUseStream || mMaxStepsInFlight) {
+    sendStep(*mStepReq);
+    return;
+  }
+
   grpc::ClientContext context;
-  proto::UpdateRenderAndTakePicturesReq req;
   proto::Empty res;
+  Status status =
+      getStub().UpdateRenderAndTakePictures(&context, *mUpdateRenderAndTakePicturesReq, &res);
+  if (!status.ok()) {
+    resetSentPoses();
+    throw std::runtime_error(status.error_message());
+  }
+}
 
-  req.set_scene_id(mServerId);
-  for (auto &body : mRenderBodies) {
-    auto b2w = body->getPose();
-    for (auto &shape : body->getRenderShapes()) {
-      auto s2b = shape->getLocalPose();
-      auto pose = b2w * s2b;
-      auto p = req.add_body_poses();
-      p->mutable_p()->set_x(pose.p.x);
-      p->mutable_p()->set_y(pose.p.y);
-      p->mutable_p()->set_z(pose.p.z);
-
-      p->mutable_q()->set_w(pose.q.w);
-      p->mutable_q()->set_x(pose.q.x);
-      p->mutable_q()->set_y(pose.q.y);
-      p->mutable_q()->set_z(pose.q.z);
+void ClientSystem::updateRenderAndTakePictures(
+    std::vector<std::shared_ptr<ClientCameraComponent>> const &cameras) {
+  waitAsync();
+  fillRenderRequest(cameras);
+  sendRenderRequest();
+}
+
+void ClientSystem::setBodyPoseInput(float const *bodyPoses, size_t count) {
+  if (bodyPoses) {
+    syncId();
+    if (count != mRenderBodies.size()) {
+      throw std::runtime_error("failed to update poses: expected " +
+                               std::to_string(mRenderBodies.size()) + " body poses, got " +
+                               std::to_string(count));
     }
   }
+  mBodyPoseInput = bodyPoses;
+}
+
+void ClientSystem::fillStepRequest(float const *bodyPoses, size_t count) {
+  setBodyPoseInput(bodyPoses, count);
+  try {
+    fillStepRequest();
+  } catch (...) {
+    mBodyPoseInput = nullptr;
+    throw;
+  }
+  mBodyPoseInput = nullptr;
+}
 
-  for (auto &cam : mCameras) {
-    auto pose = cam->getPose() * cam->getLocalPose();
+void ClientSystem::fillRenderRequest(
+    float const *bodyPoses, size_t count,
+    std::vector<std::shared_ptr<ClientCameraComponent>> const &cameras) {
+  setBodyPoseInput(bodyPoses, count);
+  try {
+    fillRenderRequest(cameras);
+  } catch (...) {
+    mBodyPoseInput = nullptr;
+    throw;
+  }
+  mBodyPoseInput = nullptr;
+}
+
+void ClientSystem::updatePoses(float const *bodyPoses, size_t count) {
+  waitAsync();
+  fillStepRequest(bodyPoses, count);
+  sendStepRequest();
+}
 
-    auto p = req.add_camera_poses();
-    p->mutable_p()->set_x(pose.p.x);
-    p->mutable_p()->set_y(pose.p.y);
-    p->mutable_p()->set_z(pose.p.z);
+void ClientSystem::updateRenderAndTakePictures(
+    float const *bodyPoses, size_t count,
+    std::vector<std::shared_ptr<ClientCameraComponent>> const &cameras) {
+  waitAsync();
+  fillRenderRequest(bodyPoses, count, cameras);
+  sendRenderRequest();
+}
 
-    p->mutable_q()->set_w(pose.q.w);
-    p->mutable_q()->set_x(pose.q.x);
-    p->mutable_q()->set_y(pose.q.y);
-    p->mutable_q()->set_z(pose.q.z);
+void ClientSystem::waitAsync() {
+  if (mLastAsync.valid()) {
+    mLastAsync.wait();
   }
+}
 
-  for (auto cam : cameras) {
-    req.add_camera_ids(cam->getServerId());
+ClientFuture ClientSystem::submitAsync(std::function<void()> func) {
+  if (!mAsyncWorker) {
+    mAsyncWorker = std::make_unique<ThreadPool>(1);
+    mAsyncWorker->init();
   }
-  Status status = getStub().UpdateRenderAndTakePictures(&context, req, &res);
+  mLastAsync = mAsyncWorker->submit(std::move(func)).share();
+  return mLastAsync;
+}
+
+// The request is filled on the calling thread, so the poses are the ones at the time of the call
+// and not whatever the caller has simulated by the time the worker gets to it. The worker only
+// sends. Waiting for the previous call first leaves the reused requests and pose buffer slots to
+// this one.
+ClientFuture ClientSystem::stepAsync() {
+  waitAsync();
+  fillStepRequest();
+  return submitAsync([this]() { sendStepRequest(); });
+}
+
+ClientFuture ClientSystem::updatePosesAsync(float const *bodyPoses, size_t count) {
+  waitAsync();
+  fillStepRequest(bodyPoses, count);
+  return submitAsync([this]() { sendStepRequest(); });
+}
+
+ClientFuture ClientSystem::updateRenderAndTakePicturesAsync(
+    std::vector<std::shared_ptr<ClientCameraComponent>> const &cameras) {
+  waitAsync();
+  fillRenderRequest(cameras);
+  return submitAsync([this]() { sendRenderRequest(); });
+}
+
+ClientSystemBatch::ClientSystemBatch(std::vector<std::shared_ptr<ClientSystem>> systems)
+    : mSystems(systems) {
+  mRequest =
+      google::protobuf::Arena::CreateMessage<proto::BatchUpdateRenderAndTakePicturesReq>(&mArena);
+  if (mSystems.empty()) {
+    throw std::runtime_error("client system batch must contain at least 1 system");
+  }
+}
+
+void ClientSystemBatch::updateRenderAndTakePictures(
+    std::vector<std::vector<std::shared_ptr<ClientCameraComponent>>> const &cameras) {
+  if (cameras.size() != mSystems.size()) {
+    throw std::runtime_error("failed to update render: camera lists do not match systems");
+  }
+
+  grpc::ClientContext context;
+  auto &req = *mRequest;
+  proto::Empty res;
+
+  // updates still queued on a system's step stream must be applied before this newer one, fence
+  // also waits for the system's async calls, which use its pose buffer
+  for (auto &system : mSystems) {
+    system->fence();
+  }
+
+  // the systems of a batch are fixed, so the scene of each is reused in place
+  if (req.scenes_size() != static_cast<int>(mSystems.size())) {
+    req.clear_scenes();
+    for (size_t i = 0; i < mSystems.size(); ++i) {
+      req.add_scenes();
+    }
+  }
+  for (size_t i = 0; i < mSystems.size(); ++i) {
+    auto &system = *mSystems[i];
+    auto &scene = *req.mutable_scenes(i);
+    system.syncId();
+    clearUpdateRequest(scene, system.mPoseBuffer != nullptr);
+    system.fillUpdate(scene, cameras[i]);
+  }
+
+  Status status = mSystems[0]->getStub().BatchUpdateRenderAndTakePictures(&context, req, &res);
   if (!status.ok()) {
+    for (auto &system : mSystems) {
+      system->resetSentPoses();
+    }
     throw std::runtime_error(status.error_message());
   }
 }
 
+void ClientSystemBatch::step() {
+  updateRenderAndTakePictures(
+      std::vector<std::vector<std::shared_ptr<ClientCameraComponent>>>(mSystems.size()));
+}
+
 ClientSystem::~ClientSystem() {
+  // usually destroyed by Python's garbage collector, other Python threads may run while this
+  // blocks on the worker and the server
+  std::optional<pybind11::gil_scoped_release> release;
+  if (Py_IsInitialized() && PyGILState_Check()) {
+    release.emplace();
+  }
+
+  // async calls run in order, so the last one finishing means all did
+  waitAsync();
+  mAsyncWorker.reset();
+  closeStepStream();
+
   grpc::ClientContext context;
   proto::Id req;
   proto::Empty res;
 
+  req.set_id(mServerId);
   Status status = mStub->RemoveScene(&context, req, &res);
   if (!status.ok()) {
     // ignore error
@@ -1,8 +1,17 @@
 #pragma once
+#include "pose_codec.h"
 #include "proto/render_server.grpc.pb.h"
 #include "sapien/system.h"
+#include "shared_pose_buffer.h"
+#include "thread_pool.hpp"
+#include <array>
+#include <condition_variable>
+#include <future>
+#include <google/protobuf/arena.h>
 #include <grpcpp/create_channel.h>
+#include <mutex>
 #include <sapien/math/pose.h>
+#include <thread>
 
 namespace sapien {
 namespace render_server {
@@ -10,9 +19,16 @@ namespace render_server {
 class ClientCameraComponent;
 class ClientRenderBodyComponent;
 
+// completion of an update run on a ClientSystem's worker thread, get() rethrows its error
+using ClientFuture = std::shared_future<void>;
+
 class ClientSystem : public sapien::System {
 public:
-  ClientSystem(std::string const &address, uint64_t index);
+  // quantizePoses sends poses in the compact encoding of pose_codec.h, positions relative to
+  // poseOrigin in units of positionStep
+  ClientSystem(std::string const &address, uint64_t index, bool sharedMemory = false,
+               bool stream = false, bool quantizePoses = false, Vec3 const &poseOrigin = Vec3(0.f),
+               float positionStep = 1.f / 4096.f);
 
   uint64_t getServerId() { return mServerId; }
   uint64_t getIndex() { return mIndex; }
@@ -30,11 +46,45 @@ public:
                            Vec3 const &position, float shadowScale, float shadowNear,
                            float shadowFar, int shadowMapSize);
 
+  // Send only the shape poses that moved more than epsilon since they were last sent, static
+  // bodies are skipped once sent. Only applies when poses travel in requests.
+  void setDeltaPoses(bool enabled, float epsilon);
+
   std::string getName() const override { return "render_system"; }
   void step() override;
   void
   updateRenderAndTakePictures(std::vector<std::shared_ptr<ClientCameraComponent>> const &cameras);
 
+  // Same as step and updateRenderAndTakePictures, with the poses of all registered bodies given
+  // as count * 7 floats (px py pz qw qx qy qz) in registration order instead of read from the
+  // components. Shape local poses are the ones captured at the last entity sync.
+  void updatePoses(float const *bodyPoses, size_t count);
+  void
+  updateRenderAndTakePictures(float const *bodyPoses, size_t count,
+                              std::vector<std::shared_ptr<ClientCameraComponent>> const &cameras);
+
+  // Pipelined updates: with maxInFlight > 0, step and updateRenderAndTakePictures write to the
+  // step stream and return without waiting for the server, so the next physics step overlaps the
+  // render. At most maxInFlight updates are unacknowledged, further ones block. An error of an
+  // earlier update is thrown by the next call that submits or waits. Other requests of this system
+  // (lights, takePicture) must follow a fence(). 0 waits for every update.
+  void setMaxStepsInFlight(uint32_t maxInFlight);
+  uint32_t getMaxStepsInFlight() const { return mMaxStepsInFlight; }
+  // ticket of the last submitted update
+  uint64_t getLastTicket() const { return mFrame; }
+  // wait until the server has applied the update of ticket and all earlier ones
+  void wait(uint64_t ticket);
+  void fence() { wait(mFrame); }
+
+  // Async step, updatePoses or updateRenderAndTakePictures. The poses are read before the call
+  // returns and only the request is sent on this system's worker thread, so the caller may go on
+  // simulating. Every update of this system, async or not, and wait/fence first wait until the
+  // previous async call is done, so they never refill a request the worker is still sending.
+  ClientFuture stepAsync();
+  ClientFuture updatePosesAsync(float const *bodyPoses, size_t count);
+  ClientFuture updateRenderAndTakePicturesAsync(
+      std::vector<std::shared_ptr<ClientCameraComponent>> const &cameras);
+
   uint64_t nextRenderId() { return mNextRenderId++; };
   ~ClientSystem();
 
@@ -42,14 +92,120 @@ private:
   void syncId();
   bool mIdSynced{false};
 
+  // write packed poses (7 floats per entity) of all shapes and cameras in entity order, shapes are
+  // skipped when bodyPoses is null
+  void writePoses(float *bodyPoses, float *cameraPoses);
+  // fill the poses of an update request, through the shared pose buffer when available
+  template <typename Req> void fillPoses(Req &req);
+  // fill a complete update of this scene rendering cameras
+  void fillUpdate(proto::UpdateRenderAndTakePicturesReq &req,
+                  std::vector<std::shared_ptr<ClientCameraComponent>> const &cameras);
+  size_t mShapeCount{0};
+
+  // fill the reused request of step or updateRenderAndTakePictures from the current poses, and
+  // send it; separate so async calls read the poses on the calling thread
+  void fillStepRequest();
+  void fillStepRequest(float const *bodyPoses, size_t count);
+  void sendStepRequest();
+  void fillRenderRequest(std::vector<std::shared_ptr<ClientCameraComponent>> const &cameras);
+  void fillRenderRequest(float const *bodyPoses, size_t count,
+                         std::vector<std::shared_ptr<ClientCameraComponent>> const &cameras);
+  void sendRenderRequest();
+
+  // requests reused by every update, cleared with update_request.h so a steady stream of updates
+  // does not allocate
+  google::protobuf::Arena mArena;
+  proto::UpdateRenderReq *mUpdateRenderReq;
+  proto::UpdateRenderAndTakePicturesReq *mUpdateRenderAndTakePicturesReq;
+  proto::StepReq *mStepReq;
+
+  // body poses of the current update when given as an array, null to read the components
+  void setBodyPoseInput(float const *bodyPoses, size_t count);
+  float const *mBodyPoseInput{nullptr};
+  // body index and local pose (7 floats) of each shape, captured at syncId
+  std::vector<uint32_t> mShapeBodyIndices;
+  std::vector<float> mShapeLocalPoses;
+
   uint64_t mIndex;
-  uint64_t mServerId;
+  uint64_t mServerId{};
   std::shared_ptr<grpc::Channel> mChannel;
   std::unique_ptr<proto::RenderService::Stub> mStub;
   uint64_t mNextRenderId{1};
 
   std::vector<std::shared_ptr<ClientCameraComponent>> mCameras;
   std::vector<std::shared_ptr<ClientRenderBodyComponent>> mRenderBodies;
+
+  // shared memory pose transport
+  // at least, pipelined updates need one slot per update in flight and one being written
+  static constexpr uint32_t kPoseBufferSlots = 4;
+  bool mUseSharedMemory{false};
+  uint32_t mPoseBufferVersion{0};
+  std::unique_ptr<SharedPoseBuffer> mPoseBuffer;
+  uint64_t mFrame{0};
+
+  // sparse pose updates
+  void fillDeltaPoses(google::protobuf::RepeatedField<uint32_t> &indices,
+                      google::protobuf::RepeatedField<float> &data);
+  // forget what was sent so the next update sends every pose, e.g. after a failed request
+  void resetSentPoses();
+  bool mDeltaPoses{false};
+  float mDeltaEpsilon{0.f};
+  std::vector<std::array<float, 7>> mSentPoses;
+
+  // quantized pose encoding
+  bool mQuantizePoses{false};
+  PoseQuantization mPoseQuantization;
+  std::vector<float> mPoseScratch;
+
+  // per-frame steps through a single StepStream instead of unary calls
+  void sendStep(proto::StepReq &req);
+  void closeStepStream();
+  bool mUseStream{false};
+  std::unique_ptr<grpc::ClientContext> mStepContext;
+  std::unique_ptr<grpc::ClientReaderWriter<proto::StepReq, proto::StepAck>> mStepStream;
+
+  // pipelined steps, acks are read on mAckThread
+  void sendStepPipelined(proto::StepReq &req);
+  void readStepAcks();
+  // cancel the step stream and throw the recorded error
+  [[noreturn]] void throwStepError();
+  uint32_t mMaxStepsInFlight{0};
+  std::thread mAckThread;
+  std::mutex mAckMutex;
+  std::condition_variable mAckCondition;
+  uint32_t mStepsInFlight{0};
+  uint64_t mAckedFrame{0};
+  std::string mStepError;
+
+  // async calls, the worker is started by the first one
+  ClientFuture submitAsync(std::function<void()> func);
+  void waitAsync();
+  std::unique_ptr<ThreadPool> mAsyncWorker;
+  ClientFuture mLastAsync;
+
+  friend class ClientSystemBatch;
+};
+
+// Sends the updates of several ClientSystems owned by this process in a single
+// BatchUpdateRenderAndTakePictures call. All systems must be connected to the same server.
+class ClientSystemBatch {
+public:
+  ClientSystemBatch(std::vector<std::shared_ptr<ClientSystem>> systems);
+
+  // cameras[i] are the cameras to render in systems[i]
+  void updateRenderAndTakePictures(
+      std::vector<std::vector<std::shared_ptr<ClientCameraComponent>>> const &cameras);
+  // update poses of all systems without rendering
+  void step();
+
+  std::vector<std::shared_ptr<ClientSystem>> const &getSystems() const { return mSystems; }
+
+private:
+  std::vector<std::shared_ptr<ClientSystem>> mSystems;
+
+  // reused by every update, as in ClientSystem
+  google::protobuf::Arena mArena;
+  proto::BatchUpdateRenderAndTakePicturesReq *mRequest;
 };
 
 } // namespace render_server
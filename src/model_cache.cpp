@@ -0,0 +1,57 @@
+#include "model_cache.h"
+
+namespace sapien {
+namespace render_server {
+
+using svulkan2::resource::SVMaterial;
+using svulkan2::resource::SVMetallicMaterial;
+using svulkan2::resource::SVModel;
+using svulkan2::resource::SVShape;
+
+// every parameter and texture of the material, with a GPU buffer of its own. The textures
+// themselves are shared.
+static std::shared_ptr<SVMaterial> cloneMaterial(std::shared_ptr<SVMaterial> material) {
+  auto mat = std::dynamic_pointer_cast<SVMetallicMaterial>(material);
+  if (!mat) {
+    return material;
+  }
+  auto result = std::make_shared<SVMetallicMaterial>();
+  result->setEmission(mat->getEmission());
+  result->setBaseColor(mat->getBaseColor());
+  result->setFresnel(mat->getFresnel());
+  result->setRoughness(mat->getRoughness());
+  result->setMetallic(mat->getMetallic());
+  result->setTransmission(mat->getTransmission());
+  result->setIor(mat->getIor());
+  result->setTransmissionRoughness(mat->getTransmissionRoughness());
+  result->setTextures(mat->getDiffuseTexture(), mat->getRoughnessTexture(),
+                      mat->getNormalTexture(), mat->getMetallicTexture(),
+                      mat->getEmissionTexture());
+  result->setTransmissionTexture(mat->getTransmissionTexture());
+  return result;
+}
+
+// loaded outside the resource manager, whose model registry would hold every model for the life
+// of the process
+std::shared_ptr<SVModel> ModelCache::loadModel(std::string const &path) {
+  auto model = SVModel::FromFile(path);
+  model->loadAsync().get();
+  return model;
+}
+
+std::shared_ptr<SVModel> ModelCache::createModel(std::string const &filename) {
+  std::string path = std::filesystem::canonical(filename).string();
+  auto mtime = std::filesystem::last_write_time(path);
+  auto model = mModels.get(path, mtime, [&]() { return loadModel(path); });
+
+  // the meshes keep the cached model alive, so it is freed with the last object using it
+  std::vector<std::shared_ptr<SVShape>> shapes;
+  for (auto &shape : model->getShapes()) {
+    std::shared_ptr<svulkan2::resource::SVMesh> mesh(model, shape->mesh.get());
+    shapes.push_back(SVShape::Create(mesh, cloneMaterial(shape->material)));
+  }
+  return SVModel::FromData(shapes);
+}
+
+} // namespace render_server
+} // namespace sapien
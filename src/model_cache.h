@@ -0,0 +1,32 @@
+#pragma once
+#include "weak_cache.h"
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <svulkan2/resource/material.h>
+#include <svulkan2/resource/model.h>
+
+namespace sapien {
+namespace render_server {
+
+// Server-wide cache of models loaded from files, keyed by canonical path and modification time.
+// Every object created from a cached model shares its meshes (and their GPU buffers), but gets
+// its own copy of the materials so material changes stay local to the object. The copies share
+// the textures, which are never modified through a material. A model stays cached while an object
+// created from it is alive, and is freed with the last one.
+class ModelCache {
+public:
+  std::shared_ptr<svulkan2::resource::SVModel> createModel(std::string const &filename);
+
+  size_t size() { return mModels.size(); }
+  inline uint64_t getHitCount() const { return mModels.getHitCount(); }
+  inline uint64_t getMissCount() const { return mModels.getMissCount(); }
+
+private:
+  std::shared_ptr<svulkan2::resource::SVModel> loadModel(std::string const &path);
+
+  WeakCache<std::string, std::filesystem::file_time_type, svulkan2::resource::SVModel> mModels;
+};
+
+} // namespace render_server
+} // namespace sapien
@@ -0,0 +1,114 @@
+#pragma once
+#include "pose_math.h"
+#include "thread_pool.hpp"
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace sapien {
+namespace render_server {
+
+// nodes whose pose changed since the last transform update, with their new poses
+template <typename Node> struct BasicDirtyNodes {
+  std::vector<Node *> nodes;
+  PoseBatch poses;
+
+  void clear() {
+    nodes.clear();
+    poses.clear();
+  }
+};
+
+// poses per task when a large scene's poses are split over the render pool
+constexpr size_t kPoseChunkSize = 1024;
+
+// record the new pose of node, node is marked dirty only when the pose differs from the last one;
+// the pose is written to the node by the transform update
+template <typename Node, typename T>
+inline void applyPose(T *node, std::array<float, 7> const &pose, std::array<float, 7> &lastPose,
+                      BasicDirtyNodes<Node> &dirtyNodes) {
+  if (pose == lastPose) {
+    return;
+  }
+  lastPose = pose;
+  dirtyNodes.nodes.push_back(node);
+  dirtyNodes.poses.push(pose.data(), node->getScale());
+}
+
+// poses sent as packed floats, 7 per entity: px, py, pz, qw, qx, qy, qz; pose i belongs to
+// nodes[i] and lastPoses[i]
+template <typename Node, typename T>
+void applyPoses(float const *pose, size_t count, T *const *nodes, std::array<float, 7> *lastPoses,
+                BasicDirtyNodes<Node> &dirtyNodes) {
+  for (size_t i = 0; i < count; ++i, pose += 7) {
+    applyPose(nodes[i], {pose[0], pose[1], pose[2], pose[3], pose[4], pose[5], pose[6]},
+              lastPoses[i], dirtyNodes);
+  }
+}
+
+// sparse poses, pose k (7 floats) belongs to nodes[indices[k]]; every index is checked before any
+// pose is applied, so an index that is out of range (>= nodeCount) or repeated throws
+// std::invalid_argument with nodes, lastPoses and dirtyNodes unchanged
+template <typename Node, typename T>
+void applySparsePoses(float const *pose, uint32_t const *indices, size_t count, T *const *nodes,
+                      size_t nodeCount, std::array<float, 7> *lastPoses,
+                      BasicDirtyNodes<Node> &dirtyNodes) {
+  // marks of the indices seen so far, all false between calls
+  thread_local std::vector<bool> seen;
+  if (seen.size() < nodeCount) {
+    seen.resize(nodeCount);
+  }
+  char const *error = nullptr;
+  size_t checked = 0;
+  for (; checked < count; ++checked) {
+    uint32_t index = indices[checked];
+    if (index >= nodeCount) {
+      error = "pose index out of range";
+      break;
+    }
+    if (seen[index]) {
+      error = "pose index repeated";
+      break;
+    }
+    seen[index] = true;
+  }
+  for (size_t k = 0; k < checked; ++k) {
+    seen[indices[k]] = false;
+  }
+  if (error) {
+    throw std::invalid_argument(error);
+  }
+
+  for (size_t k = 0; k < count; ++k, pose += 7) {
+    uint32_t index = indices[k];
+    applyPose(nodes[index], {pose[0], pose[1], pose[2], pose[3], pose[4], pose[5], pose[6]},
+              lastPoses[index], dirtyNodes);
+  }
+}
+
+// packed poses of a large scene, compared in chunks on the pool; each chunk collects its dirty
+// nodes separately and they are merged in order, so the result equals applyPoses
+template <typename Node, typename T>
+void applyPosesParallel(float const *pose, size_t count, T *const *nodes,
+                        std::array<float, 7> *lastPoses, BasicDirtyNodes<Node> &dirtyNodes,
+                        std::vector<BasicDirtyNodes<Node>> &chunkDirtyNodes,
+                        WorkStealingThreadPool &pool) {
+  size_t chunks = (count + kPoseChunkSize - 1) / kPoseChunkSize;
+  if (chunkDirtyNodes.size() < chunks) {
+    chunkDirtyNodes.resize(chunks);
+  }
+  pool.parallelFor(count, kPoseChunkSize, [&](size_t begin, size_t end) {
+    applyPoses(pose + 7 * begin, end - begin, nodes + begin, lastPoses + begin,
+               chunkDirtyNodes[begin / kPoseChunkSize]);
+  });
+  for (size_t c = 0; c < chunks; ++c) {
+    auto &chunk = chunkDirtyNodes[c];
+    dirtyNodes.nodes.insert(dirtyNodes.nodes.end(), chunk.nodes.begin(), chunk.nodes.end());
+    dirtyNodes.poses.append(chunk.poses);
+    chunk.clear();
+  }
+}
+
+} // namespace render_server
+} // namespace sapien
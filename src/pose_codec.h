@@ -0,0 +1,267 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SAPIEN_RENDER_SERVER_X86 1
+#endif
+
+namespace sapien {
+namespace render_server {
+
+// Compact pose encoding negotiated per scene at CreateScene.
+//
+// A block of count poses takes 10 bytes per pose, laid out as structure of arrays:
+//   uint32 quaternion[count]  smallest-three: largest component index in bits 30-31, the other
+//                             three components in 10 bits each (bits 20-29, 10-19, 0-9)
+//   int16 position[count][3]  fixed point, (p - origin) / positionStep
+//
+// Error bounds: each position coordinate is within positionStep / 2 of the original as long as
+// it is inside origin +- 32767 * positionStep (values outside are clamped). Each of the three
+// stored quaternion components is within 1 / (sqrt(2) * 1023) ~= 6.9e-4 of the original, the
+// recomputed largest component within about 2e-3.
+//
+// Both directions have an AVX2 path chosen at run time, 8 poses at a time, with the same results
+// as the scalar path. The encoded block may sit at any alignment, e.g. inside protobuf bytes.
+struct PoseQuantization {
+  float origin[3]{0.f, 0.f, 0.f};
+  float positionStep{1.f / 4096.f};
+};
+
+constexpr size_t kQuantizedPoseSize = 10;
+
+inline size_t getQuantizedPosesSize(size_t count) { return count * kQuantizedPoseSize; }
+
+// Quaternion components kept by the smallest-three encoding when component largest is dropped,
+// in order; written as selects so the scalar and vector paths share the same arithmetic.
+template <typename T> inline void keptComponents(T const *q, uint32_t largest, T *kept) {
+  kept[0] = largest == 0 ? q[1] : q[0];
+  kept[1] = largest <= 1 ? q[2] : q[1];
+  kept[2] = largest <= 2 ? q[3] : q[2];
+}
+
+// poses [begin, count) of a block of count poses, see encodePoses
+inline void encodePosesScalar(float const *poses, size_t count, size_t begin,
+                              PoseQuantization const &quantization, uint8_t *out) {
+  constexpr float kSqrt2 = 1.41421356f;
+  uint8_t *quats = out;
+  uint8_t *positions = out + 4 * count;
+  float invStep = 1.f / quantization.positionStep;
+
+  for (size_t i = begin; i < count; ++i) {
+    float const *pose = poses + 7 * i;
+    int16_t position[3];
+    for (int k = 0; k < 3; ++k) {
+      float v = std::nearbyint((pose[k] - quantization.origin[k]) * invStep);
+      position[k] = static_cast<int16_t>(std::clamp(v, -32767.f, 32767.f));
+    }
+    std::memcpy(positions + 6 * i, position, sizeof(position));
+
+    float const *q = pose + 3;
+    uint32_t largest = 0;
+    float largestAbs = std::fabs(q[0]);
+    for (uint32_t k = 1; k < 4; ++k) {
+      bool larger = std::fabs(q[k]) > largestAbs;
+      largest = larger ? k : largest;
+      largestAbs = larger ? std::fabs(q[k]) : largestAbs;
+    }
+    // q and -q are the same rotation, make the dropped component positive
+    float sign = q[largest] < 0.f ? -1.f : 1.f;
+
+    float kept[3];
+    keptComponents(q, largest, kept);
+    uint32_t packed = largest << 30;
+    for (int k = 0; k < 3; ++k) {
+      float v = std::nearbyint((sign * kept[k] * kSqrt2 + 1.f) * 0.5f * 1023.f);
+      packed |= static_cast<uint32_t>(std::clamp(v, 0.f, 1023.f)) << (20 - 10 * k);
+    }
+    std::memcpy(quats + 4 * i, &packed, sizeof(packed));
+  }
+}
+
+// poses [begin, count) of a block of count poses, see decodePoses
+inline void decodePosesScalar(uint8_t const *data, size_t count, size_t begin,
+                              PoseQuantization const &quantization, float *poses) {
+  constexpr float kInvSqrt2 = 0.70710678f;
+  uint8_t const *quats = data;
+  uint8_t const *positions = data + 4 * count;
+
+  for (size_t i = begin; i < count; ++i) {
+    float *pose = poses + 7 * i;
+    int16_t position[3];
+    std::memcpy(position, positions + 6 * i, sizeof(position));
+    for (int k = 0; k < 3; ++k) {
+      pose[k] = quantization.origin[k] + position[k] * quantization.positionStep;
+    }
+
+    uint32_t packed;
+    std::memcpy(&packed, quats + 4 * i, sizeof(packed));
+    uint32_t largest = packed >> 30;
+    float small[3];
+    float sum = 0.f;
+    for (int k = 0; k < 3; ++k) {
+      uint32_t v = (packed >> (20 - 10 * k)) & 1023u;
+      small[k] = (v * (2.f / 1023.f) - 1.f) * kInvSqrt2;
+      sum += small[k] * small[k];
+    }
+    float dropped = std::sqrt(std::max(0.f, 1.f - sum));
+    pose[3] = largest == 0 ? dropped : small[0];
+    pose[4] = largest == 0 ? small[0] : largest == 1 ? dropped : small[1];
+    pose[5] = largest <= 1 ? small[1] : largest == 2 ? dropped : small[2];
+    pose[6] = largest == 3 ? dropped : small[2];
+  }
+}
+
+#ifdef SAPIEN_RENDER_SERVER_X86
+// 8 poses per iteration, returns the end of the encoded range. Only AVX2 and no FMA, so the
+// results are bit-identical to the scalar path.
+__attribute__((target("avx2"))) inline size_t
+encodePosesAVX2(float const *poses, size_t count, PoseQuantization const &quantization,
+                uint8_t *out) {
+  size_t end = count / 8 * 8;
+  __m256i const stride = _mm256_setr_epi32(0, 7, 14, 21, 28, 35, 42, 49);
+  __m256 const invStep = _mm256_set1_ps(1.f / quantization.positionStep);
+  __m256 const absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+  alignas(32) int32_t position[3][8];
+
+  for (size_t i = 0; i < end; i += 8) {
+    float const *base = poses + 7 * i;
+    for (int k = 0; k < 3; ++k) {
+      __m256 p = _mm256_i32gather_ps(base + k, stride, 4);
+      __m256 v = _mm256_mul_ps(_mm256_sub_ps(p, _mm256_set1_ps(quantization.origin[k])), invStep);
+      v = _mm256_round_ps(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+      v = _mm256_min_ps(_mm256_max_ps(v, _mm256_set1_ps(-32767.f)), _mm256_set1_ps(32767.f));
+      _mm256_store_si256(reinterpret_cast<__m256i *>(position[k]), _mm256_cvttps_epi32(v));
+    }
+    int16_t packedPositions[24];
+    for (int j = 0; j < 8; ++j) {
+      for (int k = 0; k < 3; ++k) {
+        packedPositions[3 * j + k] = static_cast<int16_t>(position[k][j]);
+      }
+    }
+    std::memcpy(out + 4 * count + 6 * i, packedPositions, sizeof(packedPositions));
+
+    __m256 q[4];
+    for (int k = 0; k < 4; ++k) {
+      q[k] = _mm256_i32gather_ps(base + 3 + k, stride, 4);
+    }
+    __m256i largest = _mm256_setzero_si256();
+    __m256 largestAbs = _mm256_and_ps(q[0], absMask);
+    __m256 largestQ = q[0];
+    for (int k = 1; k < 4; ++k) {
+      __m256 abs = _mm256_and_ps(q[k], absMask);
+      __m256 larger = _mm256_cmp_ps(abs, largestAbs, _CMP_GT_OQ);
+      largest = _mm256_blendv_epi8(largest, _mm256_set1_epi32(k), _mm256_castps_si256(larger));
+      largestAbs = _mm256_blendv_ps(largestAbs, abs, larger);
+      largestQ = _mm256_blendv_ps(largestQ, q[k], larger);
+    }
+    __m256 sign = _mm256_blendv_ps(_mm256_set1_ps(1.f), _mm256_set1_ps(-1.f),
+                                   _mm256_cmp_ps(largestQ, _mm256_setzero_ps(), _CMP_LT_OQ));
+
+    __m256 kept[3];
+    kept[0] = _mm256_blendv_ps(
+        q[0], q[1], _mm256_castsi256_ps(_mm256_cmpeq_epi32(largest, _mm256_setzero_si256())));
+    kept[1] = _mm256_blendv_ps(
+        q[1], q[2], _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(2), largest)));
+    kept[2] = _mm256_blendv_ps(
+        q[2], q[3], _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(3), largest)));
+
+    __m256i packed = _mm256_slli_epi32(largest, 30);
+    for (int k = 0; k < 3; ++k) {
+      __m256 v = _mm256_mul_ps(_mm256_mul_ps(sign, kept[k]), _mm256_set1_ps(1.41421356f));
+      v = _mm256_mul_ps(_mm256_add_ps(v, _mm256_set1_ps(1.f)), _mm256_set1_ps(0.5f));
+      v = _mm256_mul_ps(v, _mm256_set1_ps(1023.f));
+      v = _mm256_round_ps(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+      v = _mm256_min_ps(_mm256_max_ps(v, _mm256_setzero_ps()), _mm256_set1_ps(1023.f));
+      __m128i shift = _mm_cvtsi32_si128(20 - 10 * k);
+      packed = _mm256_or_si256(packed, _mm256_sll_epi32(_mm256_cvttps_epi32(v), shift));
+    }
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + 4 * i), packed);
+  }
+  return end;
+}
+
+// 8 poses per iteration, returns the end of the decoded range; the quaternions are computed as
+// vectors, positions and the interleaved stores stay scalar
+__attribute__((target("avx2"))) inline size_t
+decodePosesAVX2(uint8_t const *data, size_t count, PoseQuantization const &quantization,
+                float *poses) {
+  size_t end = count / 8 * 8;
+  alignas(32) float q[4][8];
+
+  for (size_t i = 0; i < end; i += 8) {
+    __m256i packed = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(data + 4 * i));
+    __m256i largest = _mm256_srli_epi32(packed, 30);
+    __m256 small[3];
+    __m256 sum = _mm256_setzero_ps();
+    for (int k = 0; k < 3; ++k) {
+      __m256i v = _mm256_and_si256(_mm256_srl_epi32(packed, _mm_cvtsi32_si128(20 - 10 * k)),
+                                   _mm256_set1_epi32(1023));
+      small[k] = _mm256_sub_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(v), _mm256_set1_ps(2.f / 1023.f)),
+                               _mm256_set1_ps(1.f));
+      small[k] = _mm256_mul_ps(small[k], _mm256_set1_ps(0.70710678f));
+      sum = _mm256_add_ps(sum, _mm256_mul_ps(small[k], small[k]));
+    }
+    __m256 rest = _mm256_sub_ps(_mm256_set1_ps(1.f), sum);
+    __m256 dropped = _mm256_sqrt_ps(_mm256_max_ps(_mm256_setzero_ps(), rest));
+
+    // is[k]: component k was dropped
+    __m256 is[4];
+    for (int k = 0; k < 4; ++k) {
+      is[k] = _mm256_castsi256_ps(_mm256_cmpeq_epi32(largest, _mm256_set1_epi32(k)));
+    }
+    _mm256_store_ps(q[0], _mm256_blendv_ps(small[0], dropped, is[0]));
+    _mm256_store_ps(q[1], _mm256_blendv_ps(_mm256_blendv_ps(small[1], dropped, is[1]), small[0],
+                                           is[0]));
+    _mm256_store_ps(q[2], _mm256_blendv_ps(_mm256_blendv_ps(small[2], dropped, is[2]), small[1],
+                                           _mm256_or_ps(is[0], is[1])));
+    _mm256_store_ps(q[3], _mm256_blendv_ps(small[2], dropped, is[3]));
+
+    int16_t position[24];
+    std::memcpy(position, data + 4 * count + 6 * i, sizeof(position));
+    for (int j = 0; j < 8; ++j) {
+      float *pose = poses + 7 * (i + j);
+      for (int k = 0; k < 3; ++k) {
+        pose[k] = quantization.origin[k] + position[3 * j + k] * quantization.positionStep;
+      }
+      for (int k = 0; k < 4; ++k) {
+        pose[3 + k] = q[k][j];
+      }
+    }
+  }
+  return end;
+}
+#endif
+
+// poses: count * 7 floats, px py pz qw qx qy qz; out: getQuantizedPosesSize(count) bytes
+inline void encodePoses(float const *poses, size_t count, PoseQuantization const &quantization,
+                        uint8_t *out) {
+  size_t begin = 0;
+#ifdef SAPIEN_RENDER_SERVER_X86
+  static bool const hasAVX2 = __builtin_cpu_supports("avx2");
+  if (hasAVX2) {
+    begin = encodePosesAVX2(poses, count, quantization, out);
+  }
+#endif
+  encodePosesScalar(poses, count, begin, quantization, out);
+}
+
+// data: getQuantizedPosesSize(count) bytes at any alignment; poses: count * 7 floats
+inline void decodePoses(uint8_t const *data, size_t count, PoseQuantization const &quantization,
+                        float *poses) {
+  size_t begin = 0;
+#ifdef SAPIEN_RENDER_SERVER_X86
+  static bool const hasAVX2 = __builtin_cpu_supports("avx2");
+  if (hasAVX2) {
+    begin = decodePosesAVX2(data, count, quantization, poses);
+  }
+#endif
+  decodePosesScalar(data, count, begin, quantization, poses);
+}
+
+} // namespace render_server
+} // namespace sapien
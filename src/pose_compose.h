@@ -0,0 +1,116 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SAPIEN_RENDER_SERVER_X86 1
+#endif
+
+namespace sapien {
+namespace render_server {
+
+// World poses of render shapes from the poses of their bodies, as Pose::operator* computes them:
+// out[i] = bodyPoses[bodyIndices[i]] * localPoses[i], 7 floats per pose (px py pz qw qx qy qz).
+// The AVX2 path runs 8 shapes at a time without FMA, so its results are bit-identical to the
+// scalar path.
+
+inline void composeShapePosesScalar(float const *bodyPoses, uint32_t const *bodyIndices,
+                                    float const *localPoses, size_t count, size_t begin,
+                                    float *out) {
+  for (size_t i = begin; i < count; ++i) {
+    float const *b = bodyPoses + 7 * bodyIndices[i];
+    float const *l = localPoses + 7 * i;
+    float *o = out + 7 * i;
+
+    // p = pb + qb * pl * qb^-1, as v + w t + q.xyz x t with t = 2 q.xyz x v
+    float tx = 2.f * (b[5] * l[2] - b[6] * l[1]);
+    float ty = 2.f * (b[6] * l[0] - b[4] * l[2]);
+    float tz = 2.f * (b[4] * l[1] - b[5] * l[0]);
+    o[0] = b[0] + l[0] + b[3] * tx + (b[5] * tz - b[6] * ty);
+    o[1] = b[1] + l[1] + b[3] * ty + (b[6] * tx - b[4] * tz);
+    o[2] = b[2] + l[2] + b[3] * tz + (b[4] * ty - b[5] * tx);
+
+    // q = qb * ql
+    o[3] = b[3] * l[3] - b[4] * l[4] - b[5] * l[5] - b[6] * l[6];
+    o[4] = b[3] * l[4] + b[4] * l[3] + b[5] * l[6] - b[6] * l[5];
+    o[5] = b[3] * l[5] - b[4] * l[6] + b[5] * l[3] + b[6] * l[4];
+    o[6] = b[3] * l[6] + b[4] * l[5] - b[5] * l[4] + b[6] * l[3];
+  }
+}
+
+#ifdef SAPIEN_RENDER_SERVER_X86
+// 8 shapes per iteration, returns the end of the composed range. Body and local poses are
+// gathered into vectors, the interleaved stores stay scalar.
+__attribute__((target("avx2"))) inline size_t
+composeShapePosesAVX2(float const *bodyPoses, uint32_t const *bodyIndices,
+                      float const *localPoses, size_t count, float *out) {
+  size_t end = count / 8 * 8;
+  __m256i const stride = _mm256_setr_epi32(0, 7, 14, 21, 28, 35, 42, 49);
+  __m256 const two = _mm256_set1_ps(2.f);
+  alignas(32) float o[7][8];
+
+  for (size_t i = 0; i < end; i += 8) {
+    __m256i bodies = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(bodyIndices + i));
+    __m256i offsets = _mm256_mullo_epi32(bodies, _mm256_set1_epi32(7));
+    __m256 b[7], l[7];
+    for (int k = 0; k < 7; ++k) {
+      b[k] = _mm256_i32gather_ps(bodyPoses + k, offsets, 4);
+      l[k] = _mm256_i32gather_ps(localPoses + 7 * i + k, stride, 4);
+    }
+
+    // m[x][y] = b[x] * l[y], the products the scalar path takes
+    __m256 m[7][7];
+    for (int x = 3; x < 7; ++x) {
+      for (int y = 0; y < 7; ++y) {
+        m[x][y] = _mm256_mul_ps(b[x], l[y]);
+      }
+    }
+
+    __m256 t[3];
+    t[0] = _mm256_mul_ps(two, _mm256_sub_ps(m[5][2], m[6][1]));
+    t[1] = _mm256_mul_ps(two, _mm256_sub_ps(m[6][0], m[4][2]));
+    t[2] = _mm256_mul_ps(two, _mm256_sub_ps(m[4][1], m[5][0]));
+    // (q.xyz x t)[k] = q[k + 1] t[k + 2] - q[k + 2] t[k + 1], indices cyclic over xyz
+    for (int k = 0; k < 3; ++k) {
+      __m256 sum = _mm256_add_ps(_mm256_add_ps(b[k], l[k]), _mm256_mul_ps(b[3], t[k]));
+      __m256 cross = _mm256_sub_ps(_mm256_mul_ps(b[4 + (k + 1) % 3], t[(k + 2) % 3]),
+                                   _mm256_mul_ps(b[4 + (k + 2) % 3], t[(k + 1) % 3]));
+      _mm256_store_ps(o[k], _mm256_add_ps(sum, cross));
+    }
+
+    __m256 w = _mm256_sub_ps(_mm256_sub_ps(m[3][3], m[4][4]), m[5][5]);
+    _mm256_store_ps(o[3], _mm256_sub_ps(w, m[6][6]));
+    __m256 x = _mm256_add_ps(_mm256_add_ps(m[3][4], m[4][3]), m[5][6]);
+    _mm256_store_ps(o[4], _mm256_sub_ps(x, m[6][5]));
+    __m256 y = _mm256_add_ps(_mm256_sub_ps(m[3][5], m[4][6]), m[5][3]);
+    _mm256_store_ps(o[5], _mm256_add_ps(y, m[6][4]));
+    __m256 z = _mm256_sub_ps(_mm256_add_ps(m[3][6], m[4][5]), m[5][4]);
+    _mm256_store_ps(o[6], _mm256_add_ps(z, m[6][3]));
+
+    for (int j = 0; j < 8; ++j) {
+      float *pose = out + 7 * (i + j);
+      for (int k = 0; k < 7; ++k) {
+        pose[k] = o[k][j];
+      }
+    }
+  }
+  return end;
+}
+#endif
+
+// bodyPoses: 7 floats per body; bodyIndices, localPoses and out: count entries of 1, 7 and 7
+inline void composeShapePoses(float const *bodyPoses, uint32_t const *bodyIndices,
+                              float const *localPoses, size_t count, float *out) {
+  size_t begin = 0;
+#ifdef SAPIEN_RENDER_SERVER_X86
+  static bool const hasAVX2 = __builtin_cpu_supports("avx2");
+  if (hasAVX2) {
+    begin = composeShapePosesAVX2(bodyPoses, bodyIndices, localPoses, count, out);
+  }
+#endif
+  composeShapePosesScalar(bodyPoses, bodyIndices, localPoses, count, begin, out);
+}
+
+} // namespace render_server
+} // namespace sapien
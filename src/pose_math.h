@@ -0,0 +1,151 @@
+#pragma once
+#include <cstddef>
+#include <glm/glm.hpp>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SAPIEN_RENDER_SERVER_X86 1
+#endif
+
+namespace sapien {
+namespace render_server {
+
+// Poses and scales of many nodes as structure of arrays, converted to model matrices in one pass
+struct PoseBatch {
+  std::vector<float> px, py, pz;
+  std::vector<float> qw, qx, qy, qz;
+  std::vector<float> sx, sy, sz;
+
+  inline size_t size() const { return px.size(); }
+
+  // pose: px py pz qw qx qy qz
+  inline void push(float const *pose, glm::vec3 const &scale) {
+    px.push_back(pose[0]);
+    py.push_back(pose[1]);
+    pz.push_back(pose[2]);
+    qw.push_back(pose[3]);
+    qx.push_back(pose[4]);
+    qy.push_back(pose[5]);
+    qz.push_back(pose[6]);
+    sx.push_back(scale.x);
+    sy.push_back(scale.y);
+    sz.push_back(scale.z);
+  }
+
+  inline void append(PoseBatch const &other) {
+    std::vector<float> *dst[] = {&px, &py, &pz, &qw, &qx, &qy, &qz, &sx, &sy, &sz};
+    std::vector<float> const *src[] = {&other.px, &other.py, &other.pz, &other.qw, &other.qx,
+                                       &other.qy, &other.qz, &other.sx, &other.sy, &other.sz};
+    for (int k = 0; k < 10; ++k) {
+      dst[k]->insert(dst[k]->end(), src[k]->begin(), src[k]->end());
+    }
+  }
+
+  inline void clear() {
+    for (auto v : {&px, &py, &pz, &qw, &qx, &qy, &qz, &sx, &sy, &sz}) {
+      v->clear();
+    }
+  }
+};
+
+// model matrix T * R * S of pose i, the same as composing glm::translate, glm::toMat4, glm::scale
+inline void poseToMatrix(PoseBatch const &poses, size_t i, glm::mat4 &m) {
+  float w = poses.qw[i], x = poses.qx[i], y = poses.qy[i], z = poses.qz[i];
+  float xx = x * x, yy = y * y, zz = z * z;
+  float xy = x * y, xz = x * z, yz = y * z;
+  float wx = w * x, wy = w * y, wz = w * z;
+
+  m[0] = glm::vec4(1.f - 2.f * (yy + zz), 2.f * (xy + wz), 2.f * (xz - wy), 0.f) * poses.sx[i];
+  m[1] = glm::vec4(2.f * (xy - wz), 1.f - 2.f * (xx + zz), 2.f * (yz + wx), 0.f) * poses.sy[i];
+  m[2] = glm::vec4(2.f * (xz + wy), 2.f * (yz - wx), 1.f - 2.f * (xx + yy), 0.f) * poses.sz[i];
+  m[3] = glm::vec4(poses.px[i], poses.py[i], poses.pz[i], 1.f);
+}
+
+inline void posesToMatricesScalar(PoseBatch const &poses, size_t begin, size_t end,
+                                  glm::mat4 *out) {
+  for (size_t i = begin; i < end; ++i) {
+    poseToMatrix(poses, i, out[i]);
+  }
+}
+
+#ifdef SAPIEN_RENDER_SERVER_X86
+// 1 - 2 (a + b)
+__attribute__((target("avx2,fma"))) inline __m256 rotationDiagonal(__m256 a, __m256 b) {
+  return _mm256_fnmadd_ps(_mm256_set1_ps(2.f), _mm256_add_ps(a, b), _mm256_set1_ps(1.f));
+}
+// 2 (a + b)
+__attribute__((target("avx2,fma"))) inline __m256 rotationSum(__m256 a, __m256 b) {
+  return _mm256_mul_ps(_mm256_set1_ps(2.f), _mm256_add_ps(a, b));
+}
+// 2 (a - b)
+__attribute__((target("avx2,fma"))) inline __m256 rotationDiff(__m256 a, __m256 b) {
+  return _mm256_mul_ps(_mm256_set1_ps(2.f), _mm256_sub_ps(a, b));
+}
+
+// 8 poses per iteration, returns the end of the converted range
+__attribute__((target("avx2,fma"))) inline size_t
+posesToMatricesAVX2(PoseBatch const &poses, size_t begin, size_t end, glm::mat4 *out) {
+  size_t count = begin + (end - begin) / 8 * 8;
+  // matrix elements in column-major order, 8 matrices per element
+  alignas(32) float columns[16][8];
+  _mm256_store_ps(columns[3], _mm256_setzero_ps());
+  _mm256_store_ps(columns[7], _mm256_setzero_ps());
+  _mm256_store_ps(columns[11], _mm256_setzero_ps());
+  _mm256_store_ps(columns[15], _mm256_set1_ps(1.f));
+
+  for (size_t i = begin; i < count; i += 8) {
+    __m256 w = _mm256_loadu_ps(poses.qw.data() + i);
+    __m256 x = _mm256_loadu_ps(poses.qx.data() + i);
+    __m256 y = _mm256_loadu_ps(poses.qy.data() + i);
+    __m256 z = _mm256_loadu_ps(poses.qz.data() + i);
+    __m256 sx = _mm256_loadu_ps(poses.sx.data() + i);
+    __m256 sy = _mm256_loadu_ps(poses.sy.data() + i);
+    __m256 sz = _mm256_loadu_ps(poses.sz.data() + i);
+
+    __m256 xx = _mm256_mul_ps(x, x), yy = _mm256_mul_ps(y, y), zz = _mm256_mul_ps(z, z);
+    __m256 xy = _mm256_mul_ps(x, y), xz = _mm256_mul_ps(x, z), yz = _mm256_mul_ps(y, z);
+    __m256 wx = _mm256_mul_ps(w, x), wy = _mm256_mul_ps(w, y), wz = _mm256_mul_ps(w, z);
+
+    _mm256_store_ps(columns[0], _mm256_mul_ps(rotationDiagonal(yy, zz), sx));
+    _mm256_store_ps(columns[1], _mm256_mul_ps(rotationSum(xy, wz), sx));
+    _mm256_store_ps(columns[2], _mm256_mul_ps(rotationDiff(xz, wy), sx));
+    _mm256_store_ps(columns[4], _mm256_mul_ps(rotationDiff(xy, wz), sy));
+    _mm256_store_ps(columns[5], _mm256_mul_ps(rotationDiagonal(xx, zz), sy));
+    _mm256_store_ps(columns[6], _mm256_mul_ps(rotationSum(yz, wx), sy));
+    _mm256_store_ps(columns[8], _mm256_mul_ps(rotationSum(xz, wy), sz));
+    _mm256_store_ps(columns[9], _mm256_mul_ps(rotationDiff(yz, wx), sz));
+    _mm256_store_ps(columns[10], _mm256_mul_ps(rotationDiagonal(xx, yy), sz));
+    _mm256_store_ps(columns[12], _mm256_loadu_ps(poses.px.data() + i));
+    _mm256_store_ps(columns[13], _mm256_loadu_ps(poses.py.data() + i));
+    _mm256_store_ps(columns[14], _mm256_loadu_ps(poses.pz.data() + i));
+
+    for (int k = 0; k < 8; ++k) {
+      float *m = &out[i + k][0][0];
+      for (int e = 0; e < 16; ++e) {
+        m[e] = columns[e][k];
+      }
+    }
+  }
+  return count;
+}
+#endif
+
+// convert poses [begin, end) of the batch into out[begin, end)
+inline void posesToMatrices(PoseBatch const &poses, size_t begin, size_t end, glm::mat4 *out) {
+#ifdef SAPIEN_RENDER_SERVER_X86
+  static bool const hasAVX2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+  if (hasAVX2) {
+    begin = posesToMatricesAVX2(poses, begin, end, out);
+  }
+#endif
+  posesToMatricesScalar(poses, begin, end, out);
+}
+
+// convert all poses of the batch into out, which must hold poses.size() matrices
+inline void posesToMatrices(PoseBatch const &poses, glm::mat4 *out) {
+  posesToMatrices(poses, 0, poses.size(), out);
+}
+
+} // namespace render_server
+} // namespace sapien
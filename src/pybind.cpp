@@ -18,6 +18,17 @@ namespace py = pybind11;
 
 using namespace py::literals;
 using namespace sapien::render_server;
+
+// (N, 7) body poses, px py pz qw qx qy qz; float32 C-contiguous arrays are used without a copy
+using BodyPoseArray = py::array_t<float, py::array::c_style | py::array::forcecast>;
+
+static size_t checkBodyPoseArray(BodyPoseArray const &poses) {
+  if (poses.ndim() != 2 || poses.shape(1) != 7) {
+    throw std::runtime_error("poses must have shape (N, 7)");
+  }
+  return poses.shape(0);
+}
+
 PYBIND11_MODULE(pysapien_render_server, m) {
   auto sapien_pybind11_internals_id = py::cast<std::string>(py::module_::import("sapien").attr("pysapien").attr("pybind11_internals_id")());
   if (std::string(PYBIND11_INTERNALS_ID) != sapien_pybind11_internals_id) {
@@ -25,9 +36,12 @@ PYBIND11_MODULE(pysapien_render_server, m) {
   }
 
   auto PyRenderServer = py::class_<RenderServer>(m, "RenderServer");
-  auto PyRenderServerBuffer = py::class_<VulkanCudaBuffer>(m, "RenderServerBuffer");
+  auto PyRenderServerBuffer =
+      py::class_<VulkanCudaBuffer, std::shared_ptr<VulkanCudaBuffer>>(m, "RenderServerBuffer");
 
   auto PyRenderClientSystem = py::class_<ClientSystem, sapien::System>(m, "RenderClientSystem");
+  auto PyRenderClientSystemBatch = py::class_<ClientSystemBatch>(m, "RenderClientSystemBatch");
+  auto PyRenderClientFuture = py::class_<ClientFuture>(m, "RenderClientFuture");
   auto PyRenderClientCameraComponent =
       py::class_<ClientCameraComponent, sapien::Component>(m, "RenderClientCameraComponent");
   auto PyRenderClientBodyComponent =
@@ -39,34 +53,113 @@ PYBIND11_MODULE(pysapien_render_server, m) {
           m, "RenderClientShapeTriangleMesh");
 
   PyRenderClientSystem
-      .def(py::init<std::string const &, uint64_t>(), py::arg("address"), py::arg("process_index"))
+      .def(py::init<std::string const &, uint64_t, bool, bool, bool, sapien::Vec3 const &,
+                    float>(),
+           py::arg("address"), py::arg("process_index"), py::arg("shared_memory") = false,
+           py::arg("stream") = false, py::arg("quantize_poses") = false,
+           py::arg("pose_origin") = sapien::Vec3(0.f), py::arg("position_step") = 1.f / 4096.f,
+           py::call_guard<py::gil_scoped_release>())
 
       .def_property_readonly("process_index", &ClientSystem::getIndex)
       .def("get_process_index", &ClientSystem::getIndex)
-      .def("update_render_and_take_pictures", &ClientSystem::updateRenderAndTakePictures, py::arg("cameras"))
-      .def("set_ambient_light", &ClientSystem::setAmbientLight, py::arg("color"))
+      .def("step", &ClientSystem::step, py::call_guard<py::gil_scoped_release>())
+      .def("update_render_and_take_pictures",
+           py::overload_cast<std::vector<std::shared_ptr<ClientCameraComponent>> const &>(
+               &ClientSystem::updateRenderAndTakePictures),
+           py::arg("cameras"), py::call_guard<py::gil_scoped_release>())
+      .def(
+          "update_poses",
+          [](ClientSystem &system, BodyPoseArray poses) {
+            size_t count = checkBodyPoseArray(poses);
+            py::gil_scoped_release release;
+            system.updatePoses(poses.data(), count);
+          },
+          py::arg("poses"))
+      .def(
+          "update_render_and_take_pictures",
+          [](ClientSystem &system, BodyPoseArray poses,
+             std::vector<std::shared_ptr<ClientCameraComponent>> const &cameras) {
+            size_t count = checkBodyPoseArray(poses);
+            py::gil_scoped_release release;
+            system.updateRenderAndTakePictures(poses.data(), count, cameras);
+          },
+          py::arg("poses"), py::arg("cameras"))
+      .def_property("max_steps_in_flight", &ClientSystem::getMaxStepsInFlight,
+                    &ClientSystem::setMaxStepsInFlight)
+      .def("set_max_steps_in_flight", &ClientSystem::setMaxStepsInFlight,
+           py::arg("max_in_flight"), py::call_guard<py::gil_scoped_release>())
+      .def_property_readonly("last_ticket", &ClientSystem::getLastTicket)
+      .def("wait", &ClientSystem::wait, py::arg("ticket"),
+           py::call_guard<py::gil_scoped_release>())
+      .def("fence", &ClientSystem::fence, py::call_guard<py::gil_scoped_release>())
+      .def("step_async", &ClientSystem::stepAsync, py::call_guard<py::gil_scoped_release>())
+      .def(
+          "update_poses_async",
+          [](ClientSystem &system, BodyPoseArray poses) {
+            size_t count = checkBodyPoseArray(poses);
+            // the poses are read before the call returns, the array need not outlive it
+            py::gil_scoped_release release;
+            return system.updatePosesAsync(poses.data(), count);
+          },
+          py::arg("poses"))
+      .def("update_render_and_take_pictures_async",
+           &ClientSystem::updateRenderAndTakePicturesAsync, py::arg("cameras"),
+           py::call_guard<py::gil_scoped_release>())
+      .def("set_delta_poses", &ClientSystem::setDeltaPoses, py::arg("enabled"),
+           py::arg("epsilon") = 1e-6f)
+      .def("set_ambient_light", &ClientSystem::setAmbientLight, py::arg("color"),
+           py::call_guard<py::gil_scoped_release>())
       .def("add_point_light", &ClientSystem::addPointLight, py::arg("position"), py::arg("color"),
            py::arg("shadow") = false, py::arg("shadow_near") = 0.01f,
-           py::arg("shadow_far") = 100.f, py::arg("shadow_map_size") = 1024)
+           py::arg("shadow_far") = 100.f, py::arg("shadow_map_size") = 1024,
+           py::call_guard<py::gil_scoped_release>())
       .def("set_ambient_light", &ClientSystem::addDirectionalLight, py::arg("direction"),
            py::arg("color"), py::arg("shadow") = false, py::arg("position") = sapien::Vec3(0.f),
            py::arg("shadow_scale") = 5.f, py::arg("shadow_near") = 0.01f,
-           py::arg("shadow_far") = 100.f, py::arg("shadow_map_size") = 1024)
+           py::arg("shadow_far") = 100.f, py::arg("shadow_map_size") = 1024,
+           py::call_guard<py::gil_scoped_release>())
 
       ;
 
+  PyRenderClientSystemBatch
+      .def(py::init<std::vector<std::shared_ptr<ClientSystem>>>(), py::arg("systems"))
+      .def_property_readonly("systems", &ClientSystemBatch::getSystems)
+      .def("update_render_and_take_pictures", &ClientSystemBatch::updateRenderAndTakePictures,
+           py::arg("cameras"), py::call_guard<py::gil_scoped_release>())
+      .def("step", &ClientSystemBatch::step, py::call_guard<py::gil_scoped_release>());
+
+  PyRenderClientFuture
+      .def(
+          "wait", [](ClientFuture const &future) { future.wait(); },
+          py::call_guard<py::gil_scoped_release>())
+      .def(
+          "result", [](ClientFuture const &future) { future.get(); },
+          py::call_guard<py::gil_scoped_release>())
+      .def("done", [](ClientFuture const &future) {
+        return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+      });
+
   PyRenderServer.def_static("_set_shader_dir", &setDefaultShaderDirectory, py::arg("shader_dir"))
-      .def(py::init<uint32_t, uint32_t, uint32_t, std::string const &, bool>(),
+      .def_static("_set_target_shader_dir", &setTargetShaderDirectory, py::arg("render_targets"),
+                  py::arg("shader_dir"))
+      .def(py::init<uint32_t, uint32_t, uint32_t, std::string const &, bool, uint32_t,
+                    uint32_t, uint32_t, uint32_t>(),
            py::arg("max_num_materials") = 500, py::arg("max_num_textures") = 500,
            py::arg("default_mipmap_levels") = 1, py::arg("device") = "cuda",
-           py::arg("do_not_load_texture") = false)
-      .def("start", &RenderServer::start, py::arg("address"))
-      .def("stop", &RenderServer::stop)
-      .def("wait_all", &RenderServer::waitAll, py::arg("timeout") = UINT64_MAX)
+           py::arg("do_not_load_texture") = false, py::arg("num_render_threads") = 0,
+           py::arg("frames_in_flight") = 1, py::arg("num_completion_queue_threads") = 0,
+           py::arg("parallel_pose_threshold") = 8192)
+      .def("start", &RenderServer::start, py::arg("address"),
+           py::call_guard<py::gil_scoped_release>())
+      .def("stop", &RenderServer::stop, py::call_guard<py::gil_scoped_release>())
+      .def("wait_all", &RenderServer::waitAll, py::arg("timeout") = UINT64_MAX,
+           py::call_guard<py::gil_scoped_release>())
       .def("wait_scenes", &RenderServer::waitScenes, py::arg("scenes"),
-           py::arg("timeout") = UINT64_MAX)
+           py::arg("timeout") = UINT64_MAX, py::call_guard<py::gil_scoped_release>())
       .def("auto_allocate_buffers", &RenderServer::autoAllocateBuffers, py::arg("render_targets"),
-           py::return_value_policy::reference)
+           py::arg("packed") = false, py::call_guard<py::gil_scoped_release>())
+      .def_property_readonly("index_table", &RenderServer::getIndexTable)
+      .def("get_index_table", &RenderServer::getIndexTable)
       .def("summary", &RenderServer::summary);
 
   PyRenderServerBuffer.def_property_readonly("nbytes", &VulkanCudaBuffer::getSize)
@@ -94,8 +187,9 @@ PYBIND11_MODULE(pysapien_render_server, m) {
       ;
 
   PyRenderClientCameraComponent
-      .def(py::init<uint32_t, uint32_t, std::string const &>(), py::arg("width"),
-           py::arg("height"), py::arg("shader_dir") = "")
+      .def(py::init<uint32_t, uint32_t, std::string const &, std::vector<std::string> const &>(),
+           py::arg("width"), py::arg("height"), py::arg("shader_dir") = "",
+           py::arg("render_targets") = std::vector<std::string>{})
       .def_property("local_pose", &ClientCameraComponent::getLocalPose,
                     &ClientCameraComponent::setLocalPose)
       .def("get_local_pose", &ClientCameraComponent::getLocalPose)
@@ -103,10 +197,15 @@ PYBIND11_MODULE(pysapien_render_server, m) {
       .def("set_perspective_parameters", &ClientCameraComponent::setPerspectiveParameters,
            py::arg("near"), py::arg("far"), py::arg("fx"), py::arg("fy"), py::arg("cx"),
            py::arg("cy"), py::arg("skew"))
-      .def("take_picture", &ClientCameraComponent::takePicture);
+      .def("take_picture", &ClientCameraComponent::takePicture,
+           py::call_guard<py::gil_scoped_release>());
 
   PyRenderClientBodyComponent.def(py::init<>())
-      .def("attach", &ClientRenderBodyComponent::attachRenderShape, py::arg("shape"));
+      .def("attach", &ClientRenderBodyComponent::attachRenderShape, py::arg("shape"))
+      .def_property("static", &ClientRenderBodyComponent::isStatic,
+                    &ClientRenderBodyComponent::setStatic)
+      .def("is_static", &ClientRenderBodyComponent::isStatic)
+      .def("set_static", &ClientRenderBodyComponent::setStatic, py::arg("static"));
 
   PyRenderClientShape
       .def_property("local_pose", &ClientRenderShape::getLocalPose,
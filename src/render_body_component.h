@@ -11,13 +11,20 @@ public:
   ClientRenderBodyComponent();
 
   std::shared_ptr<ClientRenderBodyComponent> attachRenderShape(std::shared_ptr<ClientRenderShape>);
-  std::vector<std::shared_ptr<ClientRenderShape>> getRenderShapes() const { return mRenderShapes; }
+  std::vector<std::shared_ptr<ClientRenderShape>> const &getRenderShapes() const {
+    return mRenderShapes;
+  }
+
+  // with delta poses, a static body's poses are sent once after each entity order sync
+  void setStatic(bool isStatic) { mStatic = isStatic; }
+  bool isStatic() const { return mStatic; }
 
   void onAddToScene(Scene &scene) override;
   void onRemoveFromScene(Scene &scene) override;
 
 private:
   std::vector<std::shared_ptr<ClientRenderShape>> mRenderShapes;
+  bool mStatic{false};
 };
 
 } // namespace render_server
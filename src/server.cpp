@@ -1,7 +1,11 @@
 #include "server.h"
 #include <algorithm>
+#include <cmath>
 // #include <easy/profiler.h>
+#include <regex>
+#include <stdexcept>
 #include <string>
+#include <unordered_set>
 
 #ifdef SAPIEN_CUDA
 #include <cuda_runtime.h>
@@ -92,23 +96,89 @@ template <typename... Args> inline void error(const Args &...args){};
 template <typename... Args> inline void critical(const Args &...args){};
 } // namespace log
 
+// set from Python and read by AddCamera on the gRPC threads, both under the lock
+static std::mutex gShaderDirectoryLock;
 std::string gDefaultShaderDirectory;
-void setDefaultShaderDirectory(std::string const &dir) { gDefaultShaderDirectory = dir; }
+void setDefaultShaderDirectory(std::string const &dir) {
+  std::lock_guard lock(gShaderDirectoryLock);
+  gDefaultShaderDirectory = dir;
+}
+
+// registered pipelines by the sorted set of targets they render
+static std::map<std::vector<std::string>, std::string> gTargetShaderDirectories;
+
+static std::vector<std::string> normalizeTargetSet(std::vector<std::string> const &targets) {
+  std::vector<std::string> result;
+  for (auto const &target : targets) {
+    result.push_back(normalizeTargetName(target));
+  }
+  std::sort(result.begin(), result.end());
+  result.erase(std::unique(result.begin(), result.end()), result.end());
+  return result;
+}
+
+void setTargetShaderDirectory(std::vector<std::string> const &targets, std::string const &dir) {
+  auto provided = normalizeTargetSet(targets);
+  std::lock_guard lock(gShaderDirectoryLock);
+  gTargetShaderDirectories[provided] = dir;
+}
+
+std::string getTargetShaderDirectory(std::vector<std::string> const &targets) {
+  auto needed = normalizeTargetSet(targets);
+  std::lock_guard lock(gShaderDirectoryLock);
+  std::string const *best = nullptr;
+  size_t bestSize = SIZE_MAX;
+  for (auto const &[provided, dir] : gTargetShaderDirectories) {
+    if (provided.size() < bestSize &&
+        std::includes(provided.begin(), provided.end(), needed.begin(), needed.end())) {
+      best = &dir;
+      bestSize = provided.size();
+    }
+  }
+  return best ? *best : gDefaultShaderDirectory;
+}
+
+std::string normalizeTargetName(std::string const &name) {
+  if (name == "color" || name == "Color") {
+    return "Color";
+  }
+  if (name == "position" || name == "Position") {
+    return "Position";
+  }
+  if (name == "segmentation" || name == "Segmentation") {
+    return "Segmentation";
+  }
+  if (name == "depth" || name == "Depth") {
+    // depth attachment of the gbuffer pass
+    return "GbufferDepth";
+  }
+  throw std::invalid_argument("unknown render target " + name);
+}
 
 // ========== Renderer ==========//
 Status RenderServiceImpl::CreateScene(ServerContext *c, const proto::Index *req, proto::Id *res) {
   log::info("CreateScene");
   auto index = req->index();
-  rs_id_t id = generateId();
+
+  if (req->pose_encoding() == proto::POSE_QUANTIZED && req->position_step() < 0.f) {
+    return Status(grpc::StatusCode::INVALID_ARGUMENT,
+                  "create scene failed: position step must not be negative");
+  }
 
   auto info = std::make_shared<SceneInfo>();
   info->sceneIndex = index;
-  info->sceneId = id;
+  info->poseEncoding = req->pose_encoding();
+  info->poseQuantization.origin[0] = req->pose_origin().x();
+  info->poseQuantization.origin[1] = req->pose_origin().y();
+  info->poseQuantization.origin[2] = req->pose_origin().z();
+  if (req->position_step() > 0.f) {
+    info->poseQuantization.positionStep = req->position_step();
+  }
   info->scene = std::make_shared<svulkan2::scene::Scene>();
-  info->threadRunner = std::make_unique<ThreadPool>(1);
-  info->threadRunner->init();
+  info->threadRunner = std::make_shared<SerialExecutor>(*mRenderPool);
 
-  mSceneMap.set(id, info);
+  rs_id_t id = mSceneMap.insert(info);
+  info->sceneId = id;
 
   {
     WriteLock lock(mSceneListLock);
@@ -159,12 +229,10 @@ Status RenderServiceImpl::RemoveScene(ServerContext *c, const proto::Id *req, pr
 Status RenderServiceImpl::CreateMaterial(ServerContext *c, const proto::Empty *req,
                                          proto::Id *res) {
   log::info("CreateMaterial");
-  rs_id_t id = generateId();
-
   auto mat = std::make_shared<svulkan2::resource::SVMetallicMaterial>();
   mat->setBaseColor({1.0, 1.0, 1.0, 1.0});
 
-  mMaterialMap.set(id, mat);
+  rs_id_t id = mMaterialMap.insert(mat);
 
   res->set_id(id);
   log::info("Material Created {}", res->id());
@@ -184,10 +252,11 @@ Status RenderServiceImpl::AddBodyMesh(ServerContext *c, const proto::AddBodyMesh
   log::info("AddBodyMesh");
   rs_id_t id = generateId();
 
-  auto info = mSceneMap.get(req->scene_id());
+  auto &info = mSceneMap.get(req->scene_id());
   svulkan2::scene::Object *object =
-      &info->scene->addObject(mResourceManager->CreateModelFromFile(req->filename()));
+      &info->scene->addObject(mModelCache->createModel(req->filename()));
   info->objectMap[id] = object;
+  info->fullUpdate = true;
 
   object->setSegmentation({req->segmentation0(), req->segmentation1(), 0, 0});
 
@@ -203,7 +272,7 @@ Status RenderServiceImpl::AddBodyPrimitive(ServerContext *c, const proto::AddBod
 
   glm::vec3 scale{req->scale().x(), req->scale().y(), req->scale().z()};
   auto mat = getMaterial(mat_id);
-  auto info = mSceneMap.get(req->scene_id());
+  auto &info = mSceneMap.get(req->scene_id());
 
   svulkan2::scene::Object *object;
   switch (req->type()) {
@@ -229,7 +298,7 @@ Status RenderServiceImpl::AddBodyPrimitive(ServerContext *c, const proto::AddBod
   }
 
   case proto::PrimitiveType::CAPSULE: {
-    auto mesh = svulkan2::resource::SVMesh::CreateCapsule(scale.y, scale.x, 32, 8);
+    auto mesh = getCapsuleMesh(scale.y, scale.x, 32, 8);
     auto shape = svulkan2::resource::SVShape::Create(mesh, mat);
     object = &info->scene->addObject(svulkan2::resource::SVModel::FromData({shape}));
     object->setScale({1, 1, 1});
@@ -238,8 +307,7 @@ Status RenderServiceImpl::AddBodyPrimitive(ServerContext *c, const proto::AddBod
   }
 
   case proto::PrimitiveType::CYLINDER: {
-    auto mesh = svulkan2::resource::SVMesh::CreateCylinder(32);
-    auto shape = svulkan2::resource::SVShape::Create(mesh, mat);
+    auto shape = svulkan2::resource::SVShape::Create(mCylinderMesh, mat);
     object = &info->scene->addObject(svulkan2::resource::SVModel::FromData({shape}));
     object->setScale({scale.x, scale.y, scale.z});
     break;
@@ -252,6 +320,7 @@ Status RenderServiceImpl::AddBodyPrimitive(ServerContext *c, const proto::AddBod
   object->setSegmentation({req->segmentation0(), req->segmentation1(), 0, 0});
 
   info->objectMap[id] = object;
+  info->fullUpdate = true;
 
   info->objectMaterialIdMap[id] = {mat_id};
 
@@ -259,10 +328,26 @@ Status RenderServiceImpl::AddBodyPrimitive(ServerContext *c, const proto::AddBod
   return Status::OK;
 }
 
+std::shared_ptr<svulkan2::resource::SVMesh>
+RenderServiceImpl::getCapsuleMesh(float radius, float halfLength, int segments, int halfRings) {
+  // capsules within 1e-5 of each other share a mesh
+  constexpr float kQuantization = 1e5f;
+  std::tuple<int64_t, int64_t, int, int> key{std::llround(radius * kQuantization),
+                                             std::llround(halfLength * kQuantization), segments,
+                                             halfRings};
+
+  std::lock_guard lock(mCapsuleMeshLock);
+  auto &mesh = mCapsuleMeshes[key];
+  if (!mesh) {
+    mesh = svulkan2::resource::SVMesh::CreateCapsule(radius, halfLength, segments, halfRings);
+  }
+  return mesh;
+}
+
 Status RenderServiceImpl::RemoveBody(ServerContext *c, const proto::RemoveBodyReq *req,
                                      proto::Empty *res) {
 
-  auto info = mSceneMap.get(req->scene_id());
+  auto &info = mSceneMap.get(req->scene_id());
 
   {
     auto it = info->objectMap.find(req->body_id());
@@ -277,21 +362,30 @@ Status RenderServiceImpl::RemoveBody(ServerContext *c, const proto::RemoveBodyRe
 }
 
 void RenderServiceImpl::updateObjectMaterialMap() {
-  WriteLock lock(mObjectMaterialMap.lockWrite());
-  std::erase_if(mObjectMaterialMap.getMap(), [](const auto &item) {
-    auto const &[key, value] = item;
-    return value.expired();
-  });
+  mObjectMaterialMap.eraseIf([](auto const &value) { return value.expired(); });
 }
 
 Status RenderServiceImpl::AddCamera(ServerContext *c, const proto::AddCameraReq *req,
                                     proto::Id *res) {
   log::info("AddCamera");
+
+  // an unknown target would silently get the default pipeline and nothing to copy it from
+  std::vector<std::string> targets(req->render_targets().begin(), req->render_targets().end());
+  std::vector<std::string> renderTargets;
+  try {
+    renderTargets = normalizeTargetSet(targets);
+  } catch (std::invalid_argument const &e) {
+    return Status(grpc::StatusCode::INVALID_ARGUMENT,
+                  std::string("add camera failed: ") + e.what());
+  }
+
   try {
+    // the fill info is taken from the current buffers
+    ReadLock lock(mRenderBufferLock);
 
     rs_id_t id = generateId();
 
-    auto sceneInfo = mSceneMap.get(req->scene_id());
+    auto &sceneInfo = mSceneMap.get(req->scene_id());
 
     uint64_t cameraIndex = sceneInfo->cameraMap.size();
     auto camInfo = std::make_shared<CameraInfo>();
@@ -300,16 +394,15 @@ Status RenderServiceImpl::AddCamera(ServerContext *c, const proto::AddCameraReq
     sceneInfo->cameraMap[id] = camInfo;
     sceneInfo->cameraList.push_back(camInfo);
 
+    camInfo->renderTargets = renderTargets;
+
     auto config = std::make_shared<svulkan2::RendererConfig>();
     config->colorFormat4 = vk::Format::eR32G32B32A32Sfloat;
     config->depthFormat = vk::Format::eD32Sfloat;
-    config->shaderDir = req->shader().empty() ? gDefaultShaderDirectory : req->shader();
-
-    camInfo->renderer = std::make_unique<svulkan2::renderer::Renderer>(config);
-    camInfo->renderer->resize(req->width(), req->height());
-    camInfo->renderer->setScene(sceneInfo->scene);
+    config->shaderDir = req->shader().empty() ? getTargetShaderDirectory(targets) : req->shader();
 
     camInfo->camera = &sceneInfo->scene->addCamera();
+    sceneInfo->fullUpdate = true;
     camInfo->camera->setPerspectiveParameters(req->near(), req->far(), req->fx(), req->fy(),
                                               req->cx(), req->cy(), req->width(), req->height(),
                                               req->skew());
@@ -318,9 +411,17 @@ Status RenderServiceImpl::AddCamera(ServerContext *c, const proto::AddCameraReq
     camInfo->frameCounter = 0;
 
     camInfo->commandPool = mContext->createCommandPool();
-    camInfo->commandBuffer = camInfo->commandPool->allocateCommandBuffer();
 
-    camInfo->fillInfo = getCameraFillInfo(sceneInfo->sceneIndex, camInfo->cameraIndex);
+    camInfo->frames.resize(mFramesInFlight);
+    for (uint32_t slot = 0; slot < mFramesInFlight; ++slot) {
+      auto &frame = camInfo->frames[slot];
+      frame.renderer = std::make_unique<svulkan2::renderer::Renderer>(config);
+      frame.renderer->resize(req->width(), req->height());
+      frame.renderer->setScene(sceneInfo->scene);
+      frame.commandBuffer = camInfo->commandPool->allocateCommandBuffer();
+      frame.fillInfo = getCameraFillInfo(sceneInfo->sceneIndex, camInfo->cameraIndex, slot,
+                                         req->width(), req->height(), camInfo->renderTargets);
+    }
 
     res->set_id(id);
     log::info("Camera Added {}", id);
@@ -341,8 +442,9 @@ Status RenderServiceImpl::SetAmbientLight(ServerContext *c, const proto::IdVec3
 Status RenderServiceImpl::AddPointLight(ServerContext *c, const proto::AddPointLightReq *req,
                                         proto::Id *res) {
   rs_id_t id = generateId(); // TODO: implement remove light
-  auto info = mSceneMap.get(req->scene_id());
+  auto &info = mSceneMap.get(req->scene_id());
   auto &light = info->scene->addPointLight();
+  info->fullUpdate = true;
 
   glm::vec3 pos = {req->position().x(), req->position().y(), req->position().z()};
   glm::vec3 color = {req->color().x(), req->color().y(), req->color().z()};
@@ -360,8 +462,9 @@ Status RenderServiceImpl::AddDirectionalLight(ServerContext *c,
                                               proto::Id *res) {
   rs_id_t id = generateId(); // TODO: implement remove light
 
-  auto info = mSceneMap.get(req->scene_id());
+  auto &info = mSceneMap.get(req->scene_id());
   auto &light = info->scene->addDirectionalLight();
+  info->fullUpdate = true;
 
   glm::vec3 dir = {req->direction().x(), req->direction().y(), req->direction().z()};
   glm::vec3 pos = {req->position().x(), req->position().y(), req->position().z()};
@@ -382,7 +485,7 @@ Status RenderServiceImpl::SetEntityOrder(ServerContext *c, const proto::EntityOr
                                          proto::Empty *res) {
 
   {
-    auto info = mSceneMap.get(req->scene_id());
+    auto &info = mSceneMap.get(req->scene_id());
     info->orderedCameras.clear();
     info->orderedObjects.clear();
 
@@ -395,104 +498,394 @@ Status RenderServiceImpl::SetEntityOrder(ServerContext *c, const proto::EntityOr
     for (int i = 0; i < req->camera_ids_size(); ++i) {
       info->orderedCameras.push_back(info->cameraMap.at(req->camera_ids(i))->camera);
     }
+
+    info->lastPoses.assign(info->orderedObjects.size() + info->orderedCameras.size(),
+                           {NAN, NAN, NAN, NAN, NAN, NAN, NAN});
+    info->dirtyNodes.clear();
+    info->fullUpdate = true;
+
+    info->poseBuffer.reset();
+    if (!req->pose_buffer_name().empty()) {
+      try {
+        uint32_t slotSize = 7 * (req->body_ids_size() + req->camera_ids_size());
+        info->poseBuffer =
+            SharedPoseBuffer::Open(req->pose_buffer_name(), req->pose_buffer_slots(), slotSize);
+      } catch (std::exception const &e) {
+        return Status(grpc::StatusCode::FAILED_PRECONDITION, e.what());
+      }
+    }
+  }
+
+  return Status::OK;
+}
+
+// poses sent as repeated Pose messages (legacy clients)
+template <typename T>
+static void applyPoses(google::protobuf::RepeatedPtrField<proto::Pose> const &poses,
+                       std::vector<T *> const &nodes, std::array<float, 7> *lastPoses,
+                       DirtyNodes &dirtyNodes) {
+  for (int i = 0; i < poses.size(); ++i) {
+    auto const &pose = poses.Get(i);
+    applyPose(nodes[i],
+              {pose.p().x(), pose.p().y(), pose.p().z(), pose.q().w(), pose.q().x(), pose.q().y(),
+               pose.q().z()},
+              lastPoses[i], dirtyNodes);
   }
+}
+
+template <typename T>
+static void applyPoses(google::protobuf::RepeatedField<float> const &data,
+                       std::vector<T *> const &nodes, std::array<float, 7> *lastPoses,
+                       DirtyNodes &dirtyNodes) {
+  applyPoses(data.data(), data.size() / 7, nodes.data(), lastPoses, dirtyNodes);
+}
 
+// sparse poses, data holds 7 floats for each listed entity index; a rejected update changes nothing
+template <typename T>
+static Status applyPoses(google::protobuf::RepeatedField<uint32_t> const &indices,
+                         google::protobuf::RepeatedField<float> const &data,
+                         std::vector<T *> const &nodes, std::array<float, 7> *lastPoses,
+                         DirtyNodes &dirtyNodes) {
+  if (data.size() != 7 * indices.size()) {
+    return Status(grpc::StatusCode::INVALID_ARGUMENT,
+                  "update render failed: pose data does not match pose indices");
+  }
+  try {
+    applySparsePoses(data.data(), indices.data(), indices.size(), nodes.data(), nodes.size(),
+                     lastPoses, dirtyNodes);
+  } catch (std::invalid_argument const &e) {
+    return Status(grpc::StatusCode::INVALID_ARGUMENT,
+                  std::string("update render failed: ") + e.what());
+  }
   return Status::OK;
 }
 
+void RenderServiceImpl::applyBodyPoses(SceneInfo &info, float const *poses, size_t count) {
+  if (mParallelPoseThreshold && count >= mParallelPoseThreshold) {
+    applyPosesParallel(poses, count, info.orderedObjects.data(), info.lastPoses.data(),
+                       info.dirtyNodes, info.chunkDirtyNodes, *mRenderPool);
+  } else {
+    applyPoses(poses, count, info.orderedObjects.data(), info.lastPoses.data(), info.dirtyNodes);
+  }
+}
+
+template <typename Req>
+Status RenderServiceImpl::updateScenePoses(SceneInfo &info, Req const &req) {
+  auto bodyLastPoses = info.lastPoses.data();
+  auto cameraLastPoses = info.lastPoses.data() + info.orderedObjects.size();
+
+  if (req.has_pose_slot()) {
+    if (!info.poseBuffer) {
+      return Status(grpc::StatusCode::FAILED_PRECONDITION,
+                    "update render failed: shared pose buffer is not set up");
+    }
+    uint32_t slot = req.pose_slot().slot();
+    if (slot >= info.poseBuffer->getSlotCount() ||
+        info.poseBuffer->getFrame(slot) != req.pose_slot().frame()) {
+      return Status(grpc::StatusCode::INVALID_ARGUMENT,
+                    "update render failed: shared pose buffer slot does not hold the frame");
+    }
+    float const *poses = info.poseBuffer->getSlot(slot);
+    applyBodyPoses(info, poses, info.orderedObjects.size());
+    applyPoses(poses + 7 * info.orderedObjects.size(), info.orderedCameras.size(),
+               info.orderedCameras.data(), cameraLastPoses, info.dirtyNodes);
+    return Status::OK;
+  }
+
+  if (!req.body_pose_quantized().empty() || !req.camera_pose_quantized().empty()) {
+    if (info.poseEncoding != proto::POSE_QUANTIZED) {
+      return Status(grpc::StatusCode::FAILED_PRECONDITION,
+                    "update render failed: scene was not created with quantized poses");
+    }
+    size_t bodyCount = info.orderedObjects.size();
+    size_t cameraCount = info.orderedCameras.size();
+    if (req.body_pose_quantized().size() != getQuantizedPosesSize(bodyCount) ||
+        req.camera_pose_quantized().size() != getQuantizedPosesSize(cameraCount)) {
+      return Status(grpc::StatusCode::INVALID_ARGUMENT,
+                    "update render failed: quantized poses do not match the entity count");
+    }
+
+    thread_local std::vector<float> poses;
+    poses.resize(7 * (bodyCount + cameraCount));
+    decodePoses(reinterpret_cast<uint8_t const *>(req.body_pose_quantized().data()), bodyCount,
+                info.poseQuantization, poses.data());
+    decodePoses(reinterpret_cast<uint8_t const *>(req.camera_pose_quantized().data()),
+                cameraCount, info.poseQuantization, poses.data() + 7 * bodyCount);
+    applyBodyPoses(info, poses.data(), bodyCount);
+    applyPoses(poses.data() + 7 * bodyCount, cameraCount, info.orderedCameras.data(),
+               cameraLastPoses, info.dirtyNodes);
+    return Status::OK;
+  }
+
+  // camera poses are checked first so a rejected request leaves the scene unchanged
+  if (req.camera_pose_data_size() &&
+      static_cast<size_t>(req.camera_pose_data_size()) != 7 * info.orderedCameras.size()) {
+    return Status(grpc::StatusCode::INVALID_ARGUMENT,
+                  "update render failed: camera poses do not match the entity count");
+  }
+  if (static_cast<size_t>(req.camera_poses_size()) > info.orderedCameras.size()) {
+    return Status(grpc::StatusCode::INVALID_ARGUMENT,
+                  "update render failed: more camera poses than entities");
+  }
+
+  if (req.body_pose_indices_size()) {
+    if (auto status = applyPoses(req.body_pose_indices(), req.body_pose_data(),
+                                 info.orderedObjects, bodyLastPoses, info.dirtyNodes);
+        !status.ok()) {
+      return status;
+    }
+  } else if (req.body_pose_data_size()) {
+    if (static_cast<size_t>(req.body_pose_data_size()) != 7 * info.orderedObjects.size()) {
+      return Status(grpc::StatusCode::INVALID_ARGUMENT,
+                    "update render failed: body poses do not match the entity count");
+    }
+    applyBodyPoses(info, req.body_pose_data().data(), info.orderedObjects.size());
+  } else {
+    if (static_cast<size_t>(req.body_poses_size()) > info.orderedObjects.size()) {
+      return Status(grpc::StatusCode::INVALID_ARGUMENT,
+                    "update render failed: more body poses than entities");
+    }
+    applyPoses(req.body_poses(), info.orderedObjects, bodyLastPoses, info.dirtyNodes);
+  }
+
+  if (req.camera_pose_data_size()) {
+    applyPoses(req.camera_pose_data(), info.orderedCameras, cameraLastPoses, info.dirtyNodes);
+  } else {
+    applyPoses(req.camera_poses(), info.orderedCameras, cameraLastPoses, info.dirtyNodes);
+  }
+  return Status::OK;
+}
+
+void RenderServiceImpl::updateSceneTransforms(SceneInfo &info) {
+  auto &dirty = info.dirtyNodes;
+
+  thread_local std::vector<glm::mat4> matrices;
+  matrices.resize(dirty.nodes.size());
+  glm::mat4 *out = matrices.data();
+  bool updateChildren = !info.fullUpdate;
+
+  // posed nodes are children of the root, whose matrix never changes, so the model matrix of the
+  // pose is also the global one
+  auto update = [&dirty, out, updateChildren](size_t begin, size_t end) {
+    posesToMatrices(dirty.poses, begin, end, out);
+    for (size_t i = begin; i < end; ++i) {
+      auto node = dirty.nodes[i];
+      auto transform = node->getTransform();
+      transform.position = {dirty.poses.px[i], dirty.poses.py[i], dirty.poses.pz[i]};
+      transform.rotation = {dirty.poses.qw[i], dirty.poses.qx[i], dirty.poses.qy[i],
+                            dirty.poses.qz[i]};
+      transform.worldModelMatrix = out[i];
+      node->setTransform(transform);
+      if (updateChildren) {
+        for (auto child : node->getChildren()) {
+          child->updateGlobalModelMatrixRecursive();
+        }
+      }
+    }
+  };
+  if (mParallelPoseThreshold && dirty.nodes.size() >= mParallelPoseThreshold) {
+    mRenderPool->parallelFor(dirty.nodes.size(), kPoseChunkSize, update);
+  } else {
+    update(0, dirty.nodes.size());
+  }
+
+  uint64_t posedCount = info.orderedObjects.size() + info.orderedCameras.size();
+  uint64_t updatedCount = dirty.nodes.size();
+  if (info.fullUpdate) {
+    info.scene->getRootNode().updateGlobalModelMatrixRecursive();
+    info.fullUpdate = false;
+    updatedCount = posedCount;
+  }
+  dirty.clear();
+
+  mPosedNodeCount += posedCount;
+  mUpdatedNodeCount += updatedCount;
+}
+
 Status RenderServiceImpl::UpdateRender(ServerContext *c, const proto::UpdateRenderReq *req,
                                        proto::Empty *res) {
   // EASY_FUNCTION();
+  ReadLock lock(mRenderBufferLock);
 
-  auto info = mSceneMap.get(req->scene_id());
-
-  for (int i = 0; i < req->body_poses_size(); ++i) {
-    glm::vec3 p{req->body_poses(i).p().x(), req->body_poses(i).p().y(),
-                req->body_poses(i).p().z()};
-    glm::quat q{req->body_poses(i).q().w(), req->body_poses(i).q().x(), req->body_poses(i).q().y(),
-                req->body_poses(i).q().z()};
-    info->orderedObjects[i]->setPosition(p);
-    info->orderedObjects[i]->setRotation(q);
-  }
+  auto &info = mSceneMap.get(req->scene_id());
 
-  for (int i = 0; i < req->camera_poses_size(); ++i) {
-    glm::vec3 p{req->camera_poses(i).p().x(), req->camera_poses(i).p().y(),
-                req->camera_poses(i).p().z()};
-    glm::quat q{req->camera_poses(i).q().w(), req->camera_poses(i).q().x(),
-                req->camera_poses(i).q().y(), req->camera_poses(i).q().z()};
-    info->orderedCameras[i]->setPosition(p);
-    info->orderedCameras[i]->setRotation(q);
+  if (auto status = updateScenePoses(*info, *req); !status.ok()) {
+    return status;
   }
 
-  info->scene->getRootNode().updateGlobalModelMatrixRecursive(); // TODO: check this
+  updateSceneTransforms(*info);
 
   return Status::OK;
 }
 
 Status RenderServiceImpl::UpdateRenderAndTakePictures(
     ServerContext *c, const proto::UpdateRenderAndTakePicturesReq *req, proto::Empty *res) {
-  auto sceneInfo = mSceneMap.get(req->scene_id());
-
-  for (int i = 0; i < req->body_poses_size(); ++i) {
-    glm::vec3 p{req->body_poses(i).p().x(), req->body_poses(i).p().y(),
-                req->body_poses(i).p().z()};
-    glm::quat q{req->body_poses(i).q().w(), req->body_poses(i).q().x(), req->body_poses(i).q().y(),
-                req->body_poses(i).q().z()};
-    sceneInfo->orderedObjects[i]->setPosition(p);
-    sceneInfo->orderedObjects[i]->setRotation(q);
-  }
-
-  for (int i = 0; i < req->camera_poses_size(); ++i) {
-    glm::vec3 p{req->camera_poses(i).p().x(), req->camera_poses(i).p().y(),
-                req->camera_poses(i).p().z()};
-    glm::quat q{req->camera_poses(i).q().w(), req->camera_poses(i).q().x(),
-                req->camera_poses(i).q().y(), req->camera_poses(i).q().z()};
-    sceneInfo->orderedCameras[i]->setPosition(p);
-    sceneInfo->orderedCameras[i]->setRotation(q);
-  }
-
-  sceneInfo->scene->getRootNode().updateGlobalModelMatrixRecursive(); // TODO: check this
-
-  for (int i = 0; i < req->camera_ids_size(); ++i) {
-    uint64_t camera_id = req->camera_ids(i);
-    auto camInfo = sceneInfo->cameraMap.at(camera_id);
-    camInfo->frameCounter++;
-
-    sceneInfo->threadRunner->submit(
-        [context = mContext, sem = camInfo->semaphore.get(), cb = camInfo->commandBuffer.get(),
-         renderer = camInfo->renderer.get(), cam = camInfo->camera, fillInfo = camInfo->fillInfo,
-         frame = camInfo->frameCounter]() {
-          uint64_t waitFrame = frame - 1;
-          auto result = context->getDevice().waitSemaphores(
-              vk::SemaphoreWaitInfo({}, sem, waitFrame), UINT64_MAX);
-          if (result != vk::Result::eSuccess) {
-            throw std::runtime_error("take picture failed: wait failed");
-          }
-          cb.reset();
-          cb.begin({vk::CommandBufferUsageFlagBits::eOneTimeSubmit});
-          try {
-            renderer->render(*cam, {}, {}, {}, {});
-          } catch (std::exception const &e) {
-            log::critical("rendering failed");
-          }
-
-          for (auto &entry : fillInfo) {
-            auto [name, buffer, offset] = entry;
-            auto target = renderer->getRenderTarget(name);
-            auto extent = target->getImage().getExtent();
-            vk::Format format = target->getFormat();
-            vk::DeviceSize size =
-                extent.width * extent.height * extent.depth * svulkan2::getFormatSize(format);
-            target->getImage().recordCopyToBuffer(cb, buffer, offset, size, vk::Offset3D{0, 0, 0},
-                                                  extent);
-          }
-          cb.end();
-          context->getQueue().submit(cb, {}, {}, {}, sem, frame, {});
-        });
+  ReadLock lock(mRenderBufferLock);
+  return updateRenderAndTakePictures(*req);
+}
+
+Status RenderServiceImpl::updateRenderAndTakePictures(
+    proto::UpdateRenderAndTakePicturesReq const &req) {
+  auto &sceneInfo = mSceneMap.get(req.scene_id());
+
+  if (auto status = updateScenePoses(*sceneInfo, req); !status.ok()) {
+    return status;
+  }
+
+  updateSceneTransforms(*sceneInfo);
+
+  for (int i = 0; i < req.camera_ids_size(); ++i) {
+    submitCameraRender(*sceneInfo, *sceneInfo->cameraMap.at(req.camera_ids(i)));
+  }
+  if (req.camera_ids_size()) {
+    submitWaveEnd(*sceneInfo);
   }
   return Status::OK;
 }
 
+// format a renderer image of format source is copied out as for the buffer format f, eUndefined
+// when there is no conversion. Integer images keep their signedness since blits cannot change it.
+static vk::Format getOutputFormat(TargetFormat const &f, vk::Format source) {
+  using F = vk::Format;
+  int c = f.channels == 1 ? 0 : f.channels == 2 ? 1 : f.channels == 4 ? 2 : -1;
+  if (c < 0) {
+    return F::eUndefined;
+  }
+  switch (source) {
+  case F::eD32Sfloat:
+    return f.kind == 'f' && f.size == 4 && f.channels == 1 ? source : F::eUndefined;
+  case F::eR32G32B32A32Uint:
+  case F::eR32G32B32A32Sint: {
+    if (f.kind == 'f') {
+      return F::eUndefined;
+    }
+    bool sint = source == F::eR32G32B32A32Sint;
+    static F const uints[3][3] = {{F::eR8Uint, F::eR8G8Uint, F::eR8G8B8A8Uint},
+                                  {F::eR16Uint, F::eR16G16Uint, F::eR16G16B16A16Uint},
+                                  {F::eR32Uint, F::eR32G32Uint, F::eR32G32B32A32Uint}};
+    static F const sints[3][3] = {{F::eR8Sint, F::eR8G8Sint, F::eR8G8B8A8Sint},
+                                  {F::eR16Sint, F::eR16G16Sint, F::eR16G16B16A16Sint},
+                                  {F::eR32Sint, F::eR32G32Sint, F::eR32G32B32A32Sint}};
+    int s = f.size == 1 ? 0 : f.size == 2 ? 1 : f.size == 4 ? 2 : -1;
+    return s < 0 ? F::eUndefined : sint ? sints[s][c] : uints[s][c];
+  }
+  default: {
+    static F const floats[3] = {F::eR32Sfloat, F::eR32G32Sfloat, F::eR32G32B32A32Sfloat};
+    static F const halfs[3] = {F::eR16Sfloat, F::eR16G16Sfloat, F::eR16G16B16A16Sfloat};
+    static F const unorms[3] = {F::eR8Unorm, F::eR8G8Unorm, F::eR8G8B8A8Unorm};
+    if (f.kind == 'f' && f.size == 4) {
+      return floats[c];
+    }
+    if (f.kind == 'f' && f.size == 2) {
+      return halfs[c];
+    }
+    if (f.kind == 'u' && f.size == 1) {
+      return unorms[c];
+    }
+    return F::eUndefined;
+  }
+  }
+}
+
+// blit src into dst of the same extent, converting the format and dropping channels dst lacks.
+// src returns to its current layout so the next render pass finds it as it left it.
+static void recordConversion(vk::CommandBuffer cb, svulkan2::core::Image &src,
+                             svulkan2::core::Image &dst) {
+  vk::ImageLayout layout = src.getCurrentLayout(0);
+  src.transitionLayout(cb, layout, vk::ImageLayout::eTransferSrcOptimal,
+                       vk::AccessFlagBits::eMemoryWrite, vk::AccessFlagBits::eTransferRead,
+                       vk::PipelineStageFlagBits::eAllCommands,
+                       vk::PipelineStageFlagBits::eTransfer);
+  // the previous contents of dst were copied out by an earlier frame of this slot
+  dst.transitionLayout(cb, vk::ImageLayout::eUndefined, vk::ImageLayout::eTransferDstOptimal, {},
+                       vk::AccessFlagBits::eTransferWrite, vk::PipelineStageFlagBits::eTopOfPipe,
+                       vk::PipelineStageFlagBits::eTransfer);
+
+  auto extent = src.getExtent();
+  std::array<vk::Offset3D, 2> bounds{
+      vk::Offset3D{0, 0, 0},
+      vk::Offset3D{static_cast<int32_t>(extent.width), static_cast<int32_t>(extent.height), 1}};
+  vk::ImageSubresourceLayers layers(vk::ImageAspectFlagBits::eColor, 0, 0, 1);
+  vk::ImageBlit region(layers, bounds, layers, bounds);
+  // integer images only blit with nearest filtering, which is exact at equal extents anyway
+  cb.blitImage(src.getVulkanImage(), vk::ImageLayout::eTransferSrcOptimal, dst.getVulkanImage(),
+               vk::ImageLayout::eTransferDstOptimal, region, vk::Filter::eNearest);
+
+  src.transitionLayout(cb, vk::ImageLayout::eTransferSrcOptimal, layout,
+                       vk::AccessFlagBits::eTransferRead,
+                       vk::AccessFlagBits::eMemoryRead | vk::AccessFlagBits::eMemoryWrite,
+                       vk::PipelineStageFlagBits::eTransfer,
+                       vk::PipelineStageFlagBits::eAllCommands);
+}
+
+void RenderServiceImpl::submitCameraRender(SceneInfo &sceneInfo, CameraInfo &camInfo) {
+  uint64_t frame = ++camInfo.frameCounter;
+  uint64_t frameCount = camInfo.frames.size();
+  auto &slot = camInfo.frames[(frame - 1) % frameCount];
+
+  // the slot is free once the frame that last used it has finished
+  uint64_t waitFrame = frame > frameCount ? frame - frameCount : 0;
+
+  sceneInfo.threadRunner->submit([context = mContext, batcher = mSubmissionBatcher.get(),
+                                  sem = camInfo.semaphore.get(), cb = slot.commandBuffer.get(),
+                                  renderer = slot.renderer.get(), cam = camInfo.camera,
+                                  fillInfo = slot.fillInfo, conversions = &slot.conversionImages,
+                                  frame, waitFrame]() {
+    // the frame we wait for may still sit in the batcher
+    if (context->getDevice().getSemaphoreCounterValue(sem) < waitFrame) {
+      batcher->flush(SubmissionBatcher::FlushReason::eWait);
+    }
+    auto result =
+        context->getDevice().waitSemaphores(vk::SemaphoreWaitInfo({}, sem, waitFrame), UINT64_MAX);
+    if (result != vk::Result::eSuccess) {
+      throw std::runtime_error("take picture failed: wait failed");
+    }
+    cb.reset();
+    cb.begin({vk::CommandBufferUsageFlagBits::eOneTimeSubmit});
+    try {
+      // submits the render passes itself, only the copies below are batched
+      batcher->countUnbatched();
+      renderer->render(*cam, {}, {}, {}, {});
+    } catch (std::exception const &e) {
+      log::critical("rendering failed");
+    }
+
+    for (auto &entry : fillInfo) {
+      auto target = renderer->getRenderTarget(entry.target);
+      auto *image = &target->getImage();
+      auto extent = image->getExtent();
+      vk::Format format = getOutputFormat(entry.format, target->getFormat());
+      if (format == vk::Format::eUndefined) {
+        log::critical("render target {} cannot be converted to its buffer type", entry.target);
+        continue;
+      }
+      if (format != target->getFormat()) {
+        auto &converted = (*conversions)[entry.target];
+        if (!converted || converted->getFormat() != format || converted->getExtent() != extent) {
+          converted = std::make_unique<svulkan2::core::Image>(
+              vk::ImageType::e2D, extent, format,
+              vk::ImageUsageFlagBits::eTransferSrc | vk::ImageUsageFlagBits::eTransferDst,
+              VMA_MEMORY_USAGE_GPU_ONLY);
+        }
+        recordConversion(cb, *image, *converted);
+        image = converted.get();
+      }
+      vk::DeviceSize size = extent.width * extent.height * extent.depth * entry.format.pixelSize();
+      image->recordCopyToBuffer(cb, entry.buffer, entry.offset, size, vk::Offset3D{0, 0, 0},
+                                extent);
+    }
+    cb.end();
+    batcher->add(cb, sem, frame);
+  });
+}
+
+void RenderServiceImpl::submitWaveEnd(SceneInfo &sceneInfo) {
+  // the executor runs tasks in order, so this runs after the render tasks submitted before it
+  sceneInfo.threadRunner->submit([batcher = mSubmissionBatcher.get()]() {
+    batcher->flush(SubmissionBatcher::FlushReason::eWave);
+  });
+}
+
 // ========== Material ==========//
 Status RenderServiceImpl::SetBaseColor(ServerContext *c, const proto::IdVec4 *req,
                                        proto::Empty *res) {
@@ -550,7 +943,7 @@ Status RenderServiceImpl::SetMetallic(ServerContext *c, const proto::IdFloat *re
 
 Status RenderServiceImpl::SetVisibility(ServerContext *c, const proto::BodyFloat32Req *req,
                                         proto::Empty *res) {
-  auto info = mSceneMap.get(req->scene_id());
+  auto &info = mSceneMap.get(req->scene_id());
   auto obj = info->objectMap.at(req->body_id());
   obj->setTransparency(1 - req->value());
   return Status::OK;
@@ -559,7 +952,7 @@ Status RenderServiceImpl::SetVisibility(ServerContext *c, const proto::BodyFloat
 Status RenderServiceImpl::GetShapeCount(ServerContext *c, const proto::BodyReq *req,
                                         proto::Uint32 *res) {
   log::info("GetShapeCount {} {}", req->scene_id(), req->body_id());
-  auto info = mSceneMap.get(req->scene_id());
+  auto &info = mSceneMap.get(req->scene_id());
   auto obj = info->objectMap.at(req->body_id());
   res->set_value(obj->getModel()->getShapes().size());
   return Status::OK;
@@ -568,7 +961,7 @@ Status RenderServiceImpl::GetShapeCount(ServerContext *c, const proto::BodyReq *
 Status RenderServiceImpl::GetShapeMaterial(ServerContext *c, const proto::BodyUint32Req *req,
                                            proto::Id *res) {
   log::info("GetShapeMaterial {} {} {}", req->scene_id(), req->body_id(), req->id());
-  auto info = mSceneMap.get(req->scene_id());
+  auto &info = mSceneMap.get(req->scene_id());
   rs_id_t body_id = req->body_id();
 
   // lazy generation
@@ -577,18 +970,16 @@ Status RenderServiceImpl::GetShapeMaterial(ServerContext *c, const proto::BodyUi
     auto object = info->objectMap.at(body_id);
     if (object && object->getModel()) {
       for (auto shape : object->getModel()->getShapes()) {
-        rs_id_t mat_id = generateId();
+        rs_id_t mat_id = mObjectMaterialMap.insert(
+            std::static_pointer_cast<svulkan2::resource::SVMetallicMaterial>(shape->material));
         log::info("generate mat id {}", mat_id);
         mat_ids.push_back(mat_id);
-        mObjectMaterialMap.set(
-            mat_id,
-            std::static_pointer_cast<svulkan2::resource::SVMetallicMaterial>(shape->material));
       }
     }
     info->objectMaterialIdMap[body_id] = mat_ids;
   }
 
-  uint32_t mat_id = info->objectMaterialIdMap.at(body_id).at(req->id());
+  rs_id_t mat_id = info->objectMaterialIdMap.at(body_id).at(req->id());
 
   res->set_id(mat_id);
   return Status::OK;
@@ -599,38 +990,11 @@ Status RenderServiceImpl::TakePicture(ServerContext *c, const proto::TakePicture
                                       proto::Empty *res) {
   // EASY_FUNCTION();
   log::info("TakePicture {} {}", req->scene_id(), req->camera_id());
+  ReadLock lock(mRenderBufferLock);
 
-  auto sceneInfo = mSceneMap.get(req->scene_id());
-  auto camInfo = sceneInfo->cameraMap.at(req->camera_id());
-  camInfo->frameCounter++;
-
-  sceneInfo->threadRunner->submit([context = mContext, sem = camInfo->semaphore.get(),
-                                   cb = camInfo->commandBuffer.get(),
-                                   renderer = camInfo->renderer.get(), cam = camInfo->camera,
-                                   fillInfo = camInfo->fillInfo, frame = camInfo->frameCounter]() {
-    uint64_t waitFrame = frame - 1;
-    auto result =
-        context->getDevice().waitSemaphores(vk::SemaphoreWaitInfo({}, sem, waitFrame), UINT64_MAX);
-    if (result != vk::Result::eSuccess) {
-      throw std::runtime_error("take picture failed: wait failed");
-    }
-    cb.reset();
-    cb.begin({vk::CommandBufferUsageFlagBits::eOneTimeSubmit});
-    renderer->render(*cam, {}, {}, {}, {});
-
-    for (auto &entry : fillInfo) {
-      auto [name, buffer, offset] = entry;
-      auto target = renderer->getRenderTarget(name);
-      auto extent = target->getImage().getExtent();
-      vk::Format format = target->getFormat();
-      vk::DeviceSize size =
-          extent.width * extent.height * extent.depth * svulkan2::getFormatSize(format);
-      target->getImage().recordCopyToBuffer(cb, buffer, offset, size, vk::Offset3D{0, 0, 0},
-                                            extent);
-    }
-    cb.end();
-    context->getQueue().submit(cb, {}, {}, {}, sem, frame, {});
-  });
+  auto &sceneInfo = mSceneMap.get(req->scene_id());
+  submitCameraRender(*sceneInfo, *sceneInfo->cameraMap.at(req->camera_id()));
+  submitWaveEnd(*sceneInfo);
 
   return Status::OK;
 }
@@ -639,7 +1003,7 @@ Status RenderServiceImpl::SetCameraParameters(ServerContext *c, const proto::Cam
                                               proto::Empty *res) {
   log::info("SetCameraParameters {} {}", req->scene_id(), req->camera_id());
 
-  auto info = mSceneMap.get(req->scene_id());
+  auto &info = mSceneMap.get(req->scene_id());
   auto cam = info->cameraMap.at(req->camera_id())->camera;
   cam->setPerspectiveParameters(req->near(), req->far(), req->fx(), req->fy(), req->cx(),
                                 req->cy(), cam->getWidth(), cam->getHeight(), req->skew());
@@ -647,13 +1011,148 @@ Status RenderServiceImpl::SetCameraParameters(ServerContext *c, const proto::Cam
   return Status::OK;
 }
 
+// ========== Stream ==========//
+Status RenderServiceImpl::StepStream(
+    ServerContext *c, grpc::ServerReaderWriter<proto::StepAck, proto::StepReq> *stream) {
+  log::info("StepStream");
+
+  proto::StepReq req;
+  proto::StepAck ack;
+  while (stream->Read(&req)) {
+    Status status;
+    {
+      ReadLock lock(mRenderBufferLock);
+      status = updateRenderAndTakePictures(req.update());
+    }
+    ack.set_frame(req.frame());
+    ack.set_ok(status.ok());
+    ack.set_error(status.error_message());
+    if (!stream->Write(ack)) {
+      break;
+    }
+  }
+  return Status::OK;
+}
+
+// ========== Batch ==========//
+Status RenderServiceImpl::BatchUpdateRenderAndTakePictures(
+    ServerContext *c, const proto::BatchUpdateRenderAndTakePicturesReq *req, proto::Empty *res) {
+  log::info("BatchUpdateRenderAndTakePictures {}", req->scenes_size());
+
+  // updates run concurrently, two of the same scene would race on its state
+  std::unordered_set<uint64_t> sceneIds;
+  for (auto &update : req->scenes()) {
+    if (!sceneIds.insert(update.scene_id()).second) {
+      return Status(grpc::StatusCode::INVALID_ARGUMENT,
+                    "batch update failed: scene " + std::to_string(update.scene_id()) +
+                        " appears more than once");
+    }
+  }
+
+  ReadLock lock(mRenderBufferLock);
+  std::vector<std::future<Status>> futures;
+  futures.reserve(req->scenes_size());
+  for (auto &update : req->scenes()) {
+    futures.push_back(
+        mRenderPool->submit([this, &update]() { return updateRenderAndTakePictures(update); }));
+  }
+
+  // every update must be finished before the request goes away, report the first failure
+  Status result = Status::OK;
+  for (size_t i = 0; i < futures.size(); ++i) {
+    Status status;
+    try {
+      status = futures[i].get();
+    } catch (std::exception const &e) {
+      status = Status(grpc::StatusCode::INTERNAL, e.what());
+    }
+    if (!status.ok() && result.ok()) {
+      result = Status(status.error_code(), "scene " + std::to_string(req->scenes(i).scene_id()) +
+                                               ": " + status.error_message());
+    }
+  }
+  return result;
+}
+
+// ========== Async ==========//
+// method indices follow the rpc declaration order in render_server.proto
+static constexpr int kUpdateRenderMethod = 12;
+static constexpr int kUpdateRenderAndTakePicturesMethod = 13;
+static constexpr int kTakePictureMethod = 21;
+
+template <typename Req> class RenderServiceImpl::AsyncUnaryCall : public AsyncCall {
+public:
+  using Handler = Status (RenderServiceImpl::*)(ServerContext *, const Req *, proto::Empty *);
+
+  static void Request(RenderServiceImpl &service, grpc::ServerCompletionQueue *cq, int method,
+                      Handler handler, RequestPool<Req> &pool) {
+    auto call = new AsyncUnaryCall(service, cq, method, handler, pool);
+    service.RequestAsyncUnary(method, &call->mContext, call->mRequest.get(), &call->mResponder, cq,
+                              cq, call);
+  }
+
+  ~AsyncUnaryCall() { mPool.release(std::move(mRequest)); }
+
+  void proceed(bool ok) override {
+    // the response is sent, or the server is shutting down
+    if (mFinished || !ok) {
+      delete this;
+      return;
+    }
+
+    // keep a call of this method pending while this one is handled
+    Request(mService, mCq, mMethod, mHandler, mPool);
+
+    Status status;
+    try {
+      status = (mService.*mHandler)(&mContext, mRequest.get(), &mResponse);
+    } catch (std::exception const &e) {
+      status = Status(grpc::StatusCode::INTERNAL, e.what());
+    }
+    mFinished = true;
+    mResponder.Finish(mResponse, status, this);
+  }
+
+private:
+  AsyncUnaryCall(RenderServiceImpl &service, grpc::ServerCompletionQueue *cq, int method,
+                 Handler handler, RequestPool<Req> &pool)
+      : mService(service), mCq(cq), mMethod(method), mHandler(handler), mPool(pool),
+        mRequest(pool.acquire()), mResponder(&mContext) {}
+
+  RenderServiceImpl &mService;
+  grpc::ServerCompletionQueue *mCq;
+  int mMethod;
+  Handler mHandler;
+  RequestPool<Req> &mPool;
+
+  ServerContext mContext;
+  std::unique_ptr<Req> mRequest;
+  proto::Empty mResponse;
+  grpc::ServerAsyncResponseWriter<proto::Empty> mResponder;
+  bool mFinished{false};
+};
+
+void RenderServiceImpl::requestAsyncCalls(grpc::ServerCompletionQueue *cq) {
+  AsyncUnaryCall<proto::UpdateRenderReq>::Request(
+      *this, cq, kUpdateRenderMethod, &RenderServiceImpl::UpdateRender, mUpdateRenderReqPool);
+  AsyncUnaryCall<proto::UpdateRenderAndTakePicturesReq>::Request(
+      *this, cq, kUpdateRenderAndTakePicturesMethod,
+      &RenderServiceImpl::UpdateRenderAndTakePictures, mUpdateRenderAndTakePicturesReqPool);
+  AsyncUnaryCall<proto::TakePictureReq>::Request(
+      *this, cq, kTakePictureMethod, &RenderServiceImpl::TakePicture, mTakePictureReqPool);
+}
+
 std::shared_ptr<svulkan2::resource::SVMetallicMaterial>
 RenderServiceImpl::getMaterial(rs_id_t id) {
-  if (auto mat = mMaterialMap.get(id, nullptr)) {
-    return mat;
+  if (auto mat = mMaterialMap.find(id)) {
+    return *mat;
+  }
+  // RemoveBody and RemoveScene of any scene erase expired entries, so the entry is copied
+  auto wm = mObjectMaterialMap.copy(id);
+  if (!wm) {
+    throw std::out_of_range("invalid handle " + std::to_string(id));
   }
-  auto wm = mObjectMaterialMap.get(id);
-  if (auto mat = wm.lock()) {
+  if (auto mat = wm->lock()) {
     return mat;
   }
   throw std::out_of_range("object expired");
@@ -661,35 +1160,103 @@ RenderServiceImpl::getMaterial(rs_id_t id) {
 
 RenderServiceImpl::RenderServiceImpl(
     std::shared_ptr<svulkan2::core::Context> context,
-    std::shared_ptr<svulkan2::resource::SVResourceManager> manager)
-    : mContext(context), mResourceManager(manager) {
+    std::shared_ptr<svulkan2::resource::SVResourceManager> manager,
+    std::shared_ptr<WorkStealingThreadPool> renderPool, uint32_t framesInFlight,
+    bool asyncHotMethods, uint32_t parallelPoseThreshold)
+    : mContext(context), mResourceManager(manager), mRenderPool(renderPool),
+      mSubmissionBatcher(std::make_unique<SubmissionBatcher>(context)),
+      mParallelPoseThreshold(parallelPoseThreshold),
+      mFramesInFlight(std::max(framesInFlight, 1u)) {
+  if (asyncHotMethods) {
+    MarkMethodAsync(kUpdateRenderMethod);
+    MarkMethodAsync(kUpdateRenderAndTakePicturesMethod);
+    MarkMethodAsync(kTakePictureMethod);
+  }
 
   mCubeMesh = svulkan2::resource::SVMesh::CreateCube();
   mSphereMesh = svulkan2::resource::SVMesh::CreateUVSphere(32, 16);
   mPlaneMesh = svulkan2::resource::SVMesh::CreateYZPlane();
+  mCylinderMesh = svulkan2::resource::SVMesh::CreateCylinder(32);
+  mModelCache = std::make_unique<ModelCache>();
+}
+
+RenderServiceImpl::~RenderServiceImpl() {
+  // queued render tasks reference scene resources, they must finish before those are released;
+  // the pool belongs to RenderServer and outlives this service
+  try {
+    quiesce();
+  } catch (std::exception const &e) {
+    std::cerr << "Render server failed to finish queued frames: " << e.what() << std::endl;
+  }
 }
 
 RenderServer::RenderServer(uint32_t maxNumMaterials, uint32_t maxNumTextures,
                            uint32_t defaultMipLevels, std::string const &device,
-                           bool doNotLoadTexture) {
+                           bool doNotLoadTexture, uint32_t numRenderThreads,
+                           uint32_t framesInFlight, uint32_t numCompletionQueueThreads,
+                           uint32_t parallelPoseThreshold)
+    : mFramesInFlight(std::max(framesInFlight, 1u)),
+      mNumCompletionQueueThreads(numCompletionQueueThreads),
+      mParallelPoseThreshold(parallelPoseThreshold) {
   mContext = svulkan2::core::Context::Create(maxNumMaterials, maxNumTextures, defaultMipLevels,
                                              doNotLoadTexture, device);
   mResourceManager = mContext->createResourceManager();
+  mRenderPool = std::make_shared<WorkStealingThreadPool>(numRenderThreads);
+  mRenderPool->init();
   // spdlog::stderr_color_mt("RenderServer");
 }
 
+RenderServer::~RenderServer() {
+  // no call may reach the service once it is gone, stop is harmless when already stopped
+  if (mServer) {
+    stop();
+  }
+  // the service waits for its queued render tasks, then the pool may stop
+  mService.reset();
+  mRenderPool->shutdown();
+}
+
 void RenderServer::start(std::string const &address) {
-  mService = std::make_unique<RenderServiceImpl>(mContext, mResourceManager);
+  mService = std::make_unique<RenderServiceImpl>(mContext, mResourceManager, mRenderPool,
+                                                 mFramesInFlight, mNumCompletionQueueThreads > 0,
+                                                 mParallelPoseThreshold);
   grpc::ServerBuilder builder;
   builder.AddListeningPort(address, grpc::InsecureServerCredentials());
   builder.RegisterService(mService.get());
+  for (uint32_t i = 0; i < mNumCompletionQueueThreads; ++i) {
+    mCompletionQueues.push_back(builder.AddCompletionQueue());
+  }
   mServer = builder.BuildAndStart();
+
+  for (auto &cq : mCompletionQueues) {
+    mService->requestAsyncCalls(cq.get());
+    mCompletionQueueThreads.push_back(std::thread([cq = cq.get()]() {
+      void *tag;
+      bool ok;
+      while (cq->Next(&tag, &ok)) {
+        static_cast<RenderServiceImpl::AsyncCall *>(tag)->proceed(ok);
+      }
+    }));
+  }
   log::info("Render server listening on {}", address);
 }
 
 void RenderServer::stop() {
   mServer->Shutdown();
   mServer->Wait();
+
+  // completion queues must be shut down after the server and drained before they are destroyed
+  for (auto &cq : mCompletionQueues) {
+    cq->Shutdown();
+  }
+  for (auto &thread : mCompletionQueueThreads) {
+    thread.join();
+  }
+  mCompletionQueueThreads.clear();
+  mCompletionQueues.clear();
+
+  // nothing queued by the last calls runs after stop returns, the pool stays up for a restart
+  mService->quiesce();
 }
 
 bool RenderServer::waitAll(uint64_t timeout) {
@@ -733,19 +1300,105 @@ bool RenderServer::waitScenes(std::vector<int> const &list, uint64_t timeout) {
   throw std::runtime_error("failed to wait");
 }
 
-VulkanCudaBuffer *RenderServer::allocateBuffer(std::string const &type,
-                                               std::vector<int> const &shape) {
-  mBuffers.push_back(std::make_unique<VulkanCudaBuffer>(
+void RenderServiceImpl::quiesce() {
+  auto scenes = mSceneMap.flat();
+
+  // render tasks still queued on a scene executor have not reached the batcher yet
+  std::vector<std::future<void>> drained;
+  for (auto &kv : scenes) {
+    drained.push_back(kv.second->threadRunner->submit([]() {}));
+  }
+  for (auto &future : drained) {
+    future.wait();
+  }
+  mSubmissionBatcher->flush(SubmissionBatcher::FlushReason::eWait);
+
+  std::vector<vk::Semaphore> sems;
+  std::vector<uint64_t> values;
+  for (auto &kv : scenes) {
+    for (auto &kv2 : kv.second->cameraMap) {
+      sems.push_back(kv2.second->semaphore.get());
+      values.push_back(kv2.second->frameCounter);
+    }
+  }
+  if (sems.size() && mContext->getDevice().waitSemaphores(
+                         vk::SemaphoreWaitInfo({}, sems, values), UINT64_MAX) !=
+                         vk::Result::eSuccess) {
+    throw std::runtime_error("failed to wait for in-flight frames");
+  }
+}
+
+std::shared_ptr<VulkanCudaBuffer> RenderServer::allocateBuffer(std::string const &type,
+                                                               std::vector<int> const &shape) {
+  mBuffers.push_back(std::make_shared<VulkanCudaBuffer>(
       mContext->getDevice(), mContext->getPhysicalDevice(), type, shape));
-  return mBuffers.back().get();
+  return mBuffers.back();
 }
 
-std::vector<VulkanCudaBuffer *>
-RenderServer::autoAllocateBuffers(std::vector<std::string> renderTargets) {
-  if (mBuffers.size()) {
-    throw std::runtime_error("auto allocate buffers must to be called twice");
+void RenderServer::uploadBuffer(VulkanCudaBuffer &buffer, void const *data, size_t size) {
+  auto pool = mContext->createCommandPool();
+  auto cb = pool->allocateCommandBuffer();
+  cb->begin({vk::CommandBufferUsageFlagBits::eOneTimeSubmit});
+  // vkCmdUpdateBuffer takes at most 65536 bytes at a time
+  constexpr size_t kChunkSize = 65536;
+  auto bytes = static_cast<uint8_t const *>(data);
+  for (size_t offset = 0; offset < size; offset += kChunkSize) {
+    cb->updateBuffer(buffer.getBuffer(), offset, std::min(kChunkSize, size - offset),
+                     bytes + offset);
+  }
+  cb->end();
+  mContext->getQueue().submitAndWait(cb.get());
+}
+
+// split a render target "name[:type]" into the renderer's target name and its buffer format
+static std::pair<std::string, TargetFormat> parseRenderTarget(std::string const &spec) {
+  size_t colon = spec.find(':');
+  std::string name = normalizeTargetName(spec.substr(0, colon));
+
+  // format of the renderer image, to check the requested type converts from it
+  vk::Format source;
+  TargetFormat format;
+  if (name == "Color" || name == "Position") {
+    source = vk::Format::eR32G32B32A32Sfloat;
+    format = {'f', 4, 4};
+  } else if (name == "Segmentation") {
+    source = vk::Format::eR32G32B32A32Uint;
+    format = {'i', 4, 4};
+  } else {
+    // GbufferDepth, normalizeTargetName has rejected anything else
+    source = vk::Format::eD32Sfloat;
+    format = {'f', 4, 1};
   }
 
+  if (colon != std::string::npos) {
+    static std::regex const pattern("([fiu])([124])(?:x([124]))?");
+    std::smatch match;
+    std::string type = spec.substr(colon + 1);
+    if (!std::regex_match(type, match, pattern)) {
+      throw std::runtime_error("Invalid type " + type + " of target " + name);
+    }
+    format.kind = match[1].str()[0];
+    format.size = std::stoi(match[2]);
+    if (match[3].matched) {
+      format.channels = std::stoi(match[3]);
+    }
+    // narrower integers are blitted, which keeps the signedness of the renderer image, so the
+    // buffer must say so. 4 byte integers are copied bit for bit and may take either kind.
+    if (format.kind == 'i' && format.size < 4 && source == vk::Format::eR32G32B32A32Uint) {
+      log::warn("Target {} holds unsigned integers, its {} buffer is u{} instead", name, type,
+                format.size);
+      format.kind = 'u';
+    }
+    if (getOutputFormat(format, source) == vk::Format::eUndefined) {
+      throw std::runtime_error("Target " + name + " cannot be converted to " + type);
+    }
+  }
+  return {name, format};
+}
+
+std::vector<std::shared_ptr<VulkanCudaBuffer>>
+RenderServer::autoAllocateBuffers(std::vector<std::string> renderTargets, bool packed) {
+
   int maxSceneIndex = 0;
 
   int minCameraCount = INT32_MAX;
@@ -755,7 +1408,9 @@ RenderServer::autoAllocateBuffers(std::vector<std::string> renderTargets) {
   int minCameraWidth = INT32_MAX;
   int minCameraHeight = INT32_MAX;
 
-  // TODO: lock
+  // render requests queue copies into the current buffers, keep them out until the new ones are
+  // set up
+  WriteLock lock(mService->mRenderBufferLock);
 
   for (auto &kv : mService->mSceneMap.flat()) {
     maxSceneIndex = std::max(maxSceneIndex, static_cast<int>(kv.second->sceneIndex));
@@ -788,8 +1443,8 @@ RenderServer::autoAllocateBuffers(std::vector<std::string> renderTargets) {
     throw std::runtime_error("Some camera size is too large");
   }
 
-  if (minCameraWidth != maxCameraWidth || minCameraHeight != maxCameraHeight) {
-    log::warn("There are multiple camera sizes. This is not a good idea.");
+  if (!packed && (minCameraWidth != maxCameraWidth || minCameraHeight != maxCameraHeight)) {
+    log::warn("There are multiple camera sizes. Consider the packed layout.");
   }
 
   if (maxCameraCount != minCameraCount) {
@@ -800,44 +1455,86 @@ RenderServer::autoAllocateBuffers(std::vector<std::string> renderTargets) {
 
   int channels, formatSize;
 
-  std::vector<VulkanCudaBuffer *> buffers;
-  std::vector<size_t> strides;
-  for (std::string target : renderTargets) {
-    VulkanCudaBuffer *buffer;
-    if (target == "color" || target == "Color") {
-      target = "Color";
-      channels = 4;
-      formatSize = 4;
-      buffer = allocateBuffer(
-          "<f4", {maxSceneCount, maxCameraCount, maxCameraHeight, maxCameraWidth, channels});
-    } else if (target == "position" || target == "Position") {
-      target = "Position";
-      channels = 4;
-      formatSize = 4;
-      buffer = allocateBuffer(
-          "<f4", {maxSceneCount, maxCameraCount, maxCameraHeight, maxCameraWidth, channels});
-    } else if (target == "segmentation" || target == "Segmentation") {
-      target = "Segmentation";
-      channels = 4;
-      formatSize = 4;
-      buffer = allocateBuffer(
-          "<i4", {maxSceneCount, maxCameraCount, maxCameraHeight, maxCameraWidth, channels});
-    } else {
-      throw std::runtime_error("Target type " + target + " is not implemented");
+  // packed slices in order of frame slot, scene index and camera index
+  std::vector<std::array<int64_t, 3>> indexTable;
+  int64_t packedPixels = 0;
+  if (packed) {
+    auto scenes = mService->mSceneMap.flat();
+    std::sort(scenes.begin(), scenes.end(), [](auto const &a, auto const &b) {
+      return a.second->sceneIndex < b.second->sceneIndex;
+    });
+    indexTable.assign(mFramesInFlight * maxSceneCount * maxCameraCount, {-1, 0, 0});
+    for (uint32_t slot = 0; slot < mFramesInFlight; ++slot) {
+      for (auto &kv : scenes) {
+        for (auto &camInfo : kv.second->cameraList) {
+          int64_t height = camInfo->camera->getHeight();
+          int64_t width = camInfo->camera->getWidth();
+          size_t sceneSlot = slot * maxSceneCount + kv.second->sceneIndex;
+          size_t index = sceneSlot * maxCameraCount + camInfo->cameraIndex;
+          indexTable[index] = {packedPixels, height, width};
+          packedPixels += height * width;
+        }
+      }
     }
+    if (packedPixels > INT32_MAX) {
+      throw std::runtime_error("Packed buffers are too large");
+    }
+  }
+
+  // frame slots only get their own dimension when there is more than one
+  auto bufferShape = [&](int channels) {
+    if (packed) {
+      return std::vector<int>{static_cast<int>(packedPixels), channels};
+    }
+    std::vector<int> shape{maxSceneCount, maxCameraCount, maxCameraHeight, maxCameraWidth,
+                           channels};
+    if (mFramesInFlight > 1) {
+      shape.insert(shape.begin(), static_cast<int>(mFramesInFlight));
+    }
+    return shape;
+  };
+
+  // unknown targets fail before the current buffers are touched
+  std::vector<std::pair<std::string, TargetFormat>> parsedTargets;
+  for (auto const &spec : renderTargets) {
+    parsedTargets.push_back(parseRenderTarget(spec));
+  }
+
+  // frames in flight write to the current buffers
+  if (mBuffers.size()) {
+    mService->quiesce();
+  }
+  mBuffers.clear();
+  mIndexTable.reset();
+
+  std::vector<std::shared_ptr<VulkanCudaBuffer>> buffers;
+  std::vector<std::string> targets;
+  std::vector<size_t> strides;
+  std::vector<size_t> pixelSizes;
+  std::vector<TargetFormat> formats;
+  for (auto const &[target, format] : parsedTargets) {
+    channels = format.channels;
+    formatSize = format.size;
+    std::string type = (formatSize == 1 ? "|" : "<") + std::string(1, format.kind) +
+                       std::to_string(formatSize);
+    auto buffer = allocateBuffer(type, bufferShape(channels));
+    formats.push_back(format);
     buffers.push_back(buffer);
+    targets.push_back(target);
 
     size_t stride = maxCameraWidth * maxCameraHeight * channels * formatSize;
     strides.push_back(stride);
+    pixelSizes.push_back(channels * formatSize);
+  }
 
-    for (auto &kv : mService->mSceneMap.flat()) {
-      auto sceneIndex = kv.second->sceneIndex;
-      for (auto &kv2 : kv.second->cameraMap) {
-        auto cameraIndex = kv2.second->cameraIndex;
-        size_t offset = (sceneIndex * maxCameraCount + cameraIndex) * stride;
-        kv2.second->fillInfo.push_back({target, buffer->getBuffer(), offset});
-      }
+  if (packed) {
+    std::vector<int> shape{maxSceneCount, maxCameraCount, 3};
+    if (mFramesInFlight > 1) {
+      shape.insert(shape.begin(), static_cast<int>(mFramesInFlight));
     }
+    mIndexTable = std::make_shared<VulkanCudaBuffer>(
+        mContext->getDevice(), mContext->getPhysicalDevice(), "<i8", shape);
+    uploadBuffer(*mIndexTable, indexTable.data(), indexTable.size() * sizeof(indexTable[0]));
   }
 
   std::vector<vk::Buffer> vkBuffers;
@@ -845,35 +1542,72 @@ RenderServer::autoAllocateBuffers(std::vector<std::string> renderTargets) {
     vkBuffers.push_back(buffer->getBuffer());
   }
 
+  mService->mMaxSceneCount = maxSceneCount;
   mService->mMaxCameraCount = maxCameraCount;
-  mService->mRenderTargets = renderTargets;
+  mService->mMaxCameraWidth = maxCameraWidth;
+  mService->mMaxCameraHeight = maxCameraHeight;
+  mService->mRenderTargets = targets;
   mService->mRenderTargetBuffers = vkBuffers;
   mService->mRenderTargetStrides = strides;
+  mService->mRenderTargetFormats = formats;
+  mService->mPackedLayout = packed;
+  mService->mPackedIndexTable = std::move(indexTable);
+  mService->mRenderTargetPixelSizes = pixelSizes;
+
+  for (auto &kv : mService->mSceneMap.flat()) {
+    auto sceneIndex = kv.second->sceneIndex;
+    for (auto &kv2 : kv.second->cameraMap) {
+      auto &camInfo = *kv2.second;
+      for (uint32_t slot = 0; slot < camInfo.frames.size(); ++slot) {
+        camInfo.frames[slot].fillInfo =
+            mService->getCameraFillInfo(sceneIndex, camInfo.cameraIndex, slot,
+                                        camInfo.camera->getWidth(), camInfo.camera->getHeight(),
+                                        camInfo.renderTargets);
+      }
+    }
+  }
 
   return buffers;
 }
 
 std::string RenderServer::summary() const {
   int sceneSize, materialSize;
+  sceneSize = mService->mSceneMap.size();
+  materialSize = mService->mMaterialMap.size();
+
+  size_t capsuleMeshSize;
   {
-    auto lock = mService->mSceneMap.lockRead();
-    sceneSize = mService->mSceneMap.getMap().size();
-  }
-  {
-    auto lock = mService->mMaterialMap.lockRead();
-    materialSize = mService->mMaterialMap.getMap().size();
+    std::lock_guard lock(mService->mCapsuleMeshLock);
+    capsuleMeshSize = mService->mCapsuleMeshes.size();
   }
+  auto submitStats = mService->mSubmissionBatcher->getStats();
+  uint64_t posedNodeCount = mService->mPosedNodeCount;
+  uint64_t updatedNodeCount = mService->mUpdatedNodeCount;
 
   std::stringstream ss;
   ss << "Scene     " << sceneSize << "\n";
   ss << "Materials " << materialSize << "\n";
+  ss << "Capsules  " << capsuleMeshSize << "\n";
+  ss << "Nodes     " << updatedNodeCount << " of " << posedNodeCount << " posed nodes updated ("
+     << (posedNodeCount ? 100.0 * updatedNodeCount / posedNodeCount : 0.0) << "%)\n";
+  ss << "Models    " << mService->mModelCache->size() << " (hits "
+     << mService->mModelCache->getHitCount() << ", misses "
+     << mService->mModelCache->getMissCount() << ")\n";
+  uint64_t averageBatch = submitStats.batches ? submitStats.submissions / submitStats.batches : 0;
+  ss << "Submits   " << submitStats.submissions << " copies in " << submitStats.batches
+     << " batches (avg " << averageBatch << ", max " << submitStats.maxBatchSize << "), "
+     << submitStats.unbatchedSubmissions << " unbatched renderer submits\n";
+  ss << "Flushes   wave " << submitStats.waveFlushes << ", deadline "
+     << submitStats.deadlineFlushes << ", full " << submitStats.fullFlushes << ", wait "
+     << submitStats.waitFlushes << "\n";
   return ss.str();
 }
 
 VulkanCudaBuffer::VulkanCudaBuffer(vk::Device device, vk::PhysicalDevice physicalDevice,
                                    std::string const &type, std::vector<int> const &shape)
     : mDevice(device), mPhysicalDevice(physicalDevice), mType(type), mShape(shape) {
-  if (type.length() < 3 || (type[0] != '<' && type[0] != '>')) {
+  // '|' marks single-byte types, which have no byte order
+  if (type.length() < 3 || (type[0] != '<' && type[0] != '>' && type[0] != '|')) {
     throw std::runtime_error("invalid type");
   }
   int typeSize = std::stoi(type.substr(2));
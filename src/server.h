@@ -1,12 +1,23 @@
 #pragma once
+#include "model_cache.h"
+#include "pose_apply.h"
+#include "pose_codec.h"
 #include "proto/render_server.grpc.pb.h"
 #include "safe_map.h"
+#include "shared_pose_buffer.h"
+#include "slot_map.h"
+#include "submission_batcher.h"
 #include "thread_pool.hpp"
+#include <algorithm>
+#include <array>
 #include <grpc/grpc.h>
 #include <grpcpp/grpcpp.h>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
 #include <svulkan2/core/context.h>
+#include <svulkan2/core/image.h>
 #include <svulkan2/renderer/renderer.h>
 #include <svulkan2/resource/manager.h>
 #include <svulkan2/resource/material.h>
@@ -21,9 +32,40 @@ using rs_id_t = uint64_t;
 extern std::string gDefaultShaderDirectory;
 void setDefaultShaderDirectory(std::string const &dir);
 
+// Register a pipeline that renders only the given targets, e.g. a depth pre-pass without lighting
+// and shadow passes. A camera declaring its targets and no shader uses the registered pipeline
+// with the fewest targets that covers them.
+void setTargetShaderDirectory(std::vector<std::string> const &targets, std::string const &dir);
+// the shader directory for a camera that needs targets, the default one when none is registered
+std::string getTargetShaderDirectory(std::vector<std::string> const &targets);
+// renderer name of a render target, e.g. Color for color, throws std::invalid_argument for an
+// unknown name
+std::string normalizeTargetName(std::string const &name);
+
 using grpc::ServerContext;
 using grpc::Status;
 
+using DirtyNodes = BasicDirtyNodes<svulkan2::scene::Node>;
+
+// element type of a render target buffer: kind is 'f' (float), 'u' (unsigned, normalized for
+// float images) or 'i' (signed integer). A renderer image of another format is converted on the
+// GPU before the copy.
+struct TargetFormat {
+  char kind;
+  uint32_t size;
+  uint32_t channels;
+
+  uint32_t pixelSize() const { return size * channels; }
+};
+
+// where one render target of a camera frame is copied to
+struct TargetFill {
+  std::string target;
+  vk::Buffer buffer;
+  vk::DeviceSize offset;
+  TargetFormat format;
+};
+
 class RenderServiceImpl final : public proto::RenderService::Service {
 
   // NOTE: Important assumption
@@ -71,10 +113,63 @@ class RenderServiceImpl final : public proto::RenderService::Service {
                      proto::Empty *res) override;
   Status SetCameraParameters(ServerContext *c, const proto::CameraParamsReq *req,
                              proto::Empty *res) override;
+  // ========== Stream ==========//
+  Status StepStream(ServerContext *c,
+                    grpc::ServerReaderWriter<proto::StepAck, proto::StepReq> *stream) override;
+  // ========== Batch ==========//
+  Status BatchUpdateRenderAndTakePictures(ServerContext *c,
+                                          const proto::BatchUpdateRenderAndTakePicturesReq *req,
+                                          proto::Empty *res) override;
+  // ========== Async ==========//
+  // In async mode UpdateRender, UpdateRenderAndTakePictures and TakePicture are served from
+  // completion queues. Their handlers run on the queue's polling thread and hand render work
+  // straight to the scene executor, all other methods stay on gRPC's sync thread pool.
+  template <typename Req> class AsyncUnaryCall;
+
+  // request messages of finished async calls, reused so that parsing the next request into them
+  // keeps the capacity of their pose fields instead of allocating it again
+  template <typename Req> class RequestPool {
+  public:
+    std::unique_ptr<Req> acquire() {
+      std::lock_guard lock(mMutex);
+      if (mFree.empty()) {
+        return std::make_unique<Req>();
+      }
+      auto req = std::move(mFree.back());
+      mFree.pop_back();
+      return req;
+    }
+
+    void release(std::unique_ptr<Req> req) {
+      req->Clear();
+      std::lock_guard lock(mMutex);
+      mFree.push_back(std::move(req));
+    }
+
+  private:
+    std::mutex mMutex;
+    std::vector<std::unique_ptr<Req>> mFree;
+  };
+  RequestPool<proto::UpdateRenderReq> mUpdateRenderReqPool;
+  RequestPool<proto::UpdateRenderAndTakePicturesReq> mUpdateRenderAndTakePicturesReqPool;
+  RequestPool<proto::TakePictureReq> mTakePictureReqPool;
 
 public:
+  // a call waiting on a completion queue, its tag is the call itself
+  class AsyncCall {
+  public:
+    virtual ~AsyncCall() = default;
+    virtual void proceed(bool ok) = 0;
+  };
+
   RenderServiceImpl(std::shared_ptr<svulkan2::core::Context> context,
-                    std::shared_ptr<svulkan2::resource::SVResourceManager> manager);
+                    std::shared_ptr<svulkan2::resource::SVResourceManager> manager,
+                    std::shared_ptr<WorkStealingThreadPool> renderPool, uint32_t framesInFlight,
+                    bool asyncHotMethods, uint32_t parallelPoseThreshold);
+  ~RenderServiceImpl();
+
+  // start accepting the async methods on cq, only valid with asyncHotMethods
+  void requestAsyncCalls(grpc::ServerCompletionQueue *cq);
 
   friend class RenderServer;
 
@@ -84,19 +179,41 @@ private:
   std::shared_ptr<svulkan2::core::Context> mContext;
   std::shared_ptr<svulkan2::resource::SVResourceManager> mResourceManager;
 
+  // render tasks of all scenes run on this pool, each scene through its own SerialExecutor
+  std::shared_ptr<WorkStealingThreadPool> mRenderPool;
+
+  // camera command buffers of all scenes reach the queue through this
+  std::unique_ptr<SubmissionBatcher> mSubmissionBatcher;
+
+  // scenes with at least this many posed bodies or dirty nodes apply poses and update transforms
+  // in chunks on mRenderPool, 0 always uses the calling thread
+  uint32_t mParallelPoseThreshold;
+
   std::atomic<uint64_t> mIdGenerator{0};
 
+  // resources used by one in-flight frame of a camera. Renderer::render records and submits the
+  // renderer's own command buffers, so overlapping frames need separate renderers as well.
+  struct CameraFrame {
+    std::unique_ptr<svulkan2::renderer::Renderer> renderer;
+    vk::UniqueCommandBuffer commandBuffer;
+
+    std::vector<TargetFill> fillInfo;
+    // render targets converted to their buffer format before the copy, by target name
+    std::unordered_map<std::string, std::unique_ptr<svulkan2::core::Image>> conversionImages;
+  };
+
   struct CameraInfo {
     uint64_t cameraIndex;
+    // targets the camera renders, as normalized names; empty for all
+    std::vector<std::string> renderTargets;
     svulkan2::scene::Camera *camera;
-    std::unique_ptr<svulkan2::renderer::Renderer> renderer;
     uint64_t frameCounter{};
     vk::UniqueSemaphore semaphore;
 
     std::unique_ptr<svulkan2::core::CommandPool> commandPool;
-    vk::UniqueCommandBuffer commandBuffer;
 
-    std::vector<std::tuple<std::string, vk::Buffer, vk::DeviceSize>> fillInfo;
+    // frame n (starting at 1) uses frames[(n - 1) % size] and signals semaphore with value n
+    std::vector<CameraFrame> frames;
   };
 
   struct SceneInfo {
@@ -116,14 +233,48 @@ private:
     std::vector<svulkan2::scene::Object *> orderedObjects;
     std::vector<svulkan2::scene::Camera *> orderedCameras;
 
-    std::unique_ptr<ThreadPool> threadRunner;
+    // encoding of quantized poses, negotiated at CreateScene
+    proto::PoseEncoding poseEncoding{proto::POSE_FLOAT};
+    PoseQuantization poseQuantization;
+
+    // poses written by a client on the same host, laid out in entity order
+    std::unique_ptr<SharedPoseBuffer> poseBuffer;
+
+    // last applied pose of each ordered entity (bodies first), only changed poses mark a node dirty
+    std::vector<std::array<float, 7>> lastPoses;
+    DirtyNodes dirtyNodes;
+    // per-chunk dirty nodes of parallel pose application
+    std::vector<DirtyNodes> chunkDirtyNodes;
+    // set when nodes are added or reordered, the next update recomputes every node
+    bool fullUpdate{true};
+
+    std::shared_ptr<SerialExecutor> threadRunner;
   };
 
+  // apply body and camera poses from an update request to the ordered entities
+  template <typename Req> Status updateScenePoses(SceneInfo &info, Req const &req);
+  // apply packed body poses, in parallel for large scenes
+  void applyBodyPoses(SceneInfo &info, float const *poses, size_t count);
+  // recompute global model matrices of the dirty nodes, converting their poses in SIMD batches
+  void updateSceneTransforms(SceneInfo &info);
+  // posed nodes seen and recomputed by updateSceneTransforms, for summary
+  std::atomic<uint64_t> mPosedNodeCount{0};
+  std::atomic<uint64_t> mUpdatedNodeCount{0};
+
+  // shared by the unary and streaming step
+  Status updateRenderAndTakePictures(proto::UpdateRenderAndTakePicturesReq const &req);
+
+  // start the next frame of a camera on the scene's executor
+  void submitCameraRender(SceneInfo &sceneInfo, CameraInfo &camInfo);
+  // submit the batched command buffers once the scene's queued render tasks are recorded
+  void submitWaveEnd(SceneInfo &sceneInfo);
+  uint32_t mFramesInFlight;
+
   // store materials on an object
-  ts_unordered_map<rs_id_t, std::weak_ptr<svulkan2::resource::SVMetallicMaterial>>
-      mObjectMaterialMap;
-  ts_unordered_map<rs_id_t, std::shared_ptr<svulkan2::resource::SVMetallicMaterial>> mMaterialMap;
-  ts_unordered_map<rs_id_t, std::shared_ptr<SceneInfo>> mSceneMap;
+  // scene and material ids are handles of these maps, each map has its own tag
+  SlotMap<std::weak_ptr<svulkan2::resource::SVMetallicMaterial>> mObjectMaterialMap{3};
+  SlotMap<std::shared_ptr<svulkan2::resource::SVMetallicMaterial>> mMaterialMap{2};
+  SlotMap<std::shared_ptr<SceneInfo>> mSceneMap{1};
 
   std::shared_ptr<svulkan2::resource::SVMetallicMaterial> getMaterial(rs_id_t id);
 
@@ -131,30 +282,77 @@ private:
   void updateObjectMaterialMap();
 
   std::shared_mutex mSceneListLock;
+
+  // held shared by requests that queue renders or read the buffer layout, and exclusively by
+  // RenderServer::autoAllocateBuffers while it replaces the buffers
+  std::shared_mutex mRenderBufferLock;
   std::vector<std::shared_ptr<SceneInfo>> mSceneList;
 
   std::shared_ptr<svulkan2::resource::SVMesh> mCubeMesh;
   std::shared_ptr<svulkan2::resource::SVMesh> mSphereMesh;
   std::shared_ptr<svulkan2::resource::SVMesh> mPlaneMesh;
+  std::shared_ptr<svulkan2::resource::SVMesh> mCylinderMesh;
+
+  // capsules cannot be scaled from a unit mesh, share them by quantized shape instead
+  std::shared_ptr<svulkan2::resource::SVMesh> getCapsuleMesh(float radius, float halfLength,
+                                                              int segments, int halfRings);
+  std::mutex mCapsuleMeshLock;
+  std::map<std::tuple<int64_t, int64_t, int, int>, std::shared_ptr<svulkan2::resource::SVMesh>>
+      mCapsuleMeshes;
+
+  // meshes loaded by AddBodyMesh, shared across scenes
+  std::unique_ptr<ModelCache> mModelCache;
 
   // HACK: store info for filling camera fill info
-  std::vector<std::tuple<std::string, vk::Buffer, size_t>>
-  getCameraFillInfo(uint64_t sceneIndex, uint64_t cameraIndex) {
-    std::vector<std::tuple<std::string, vk::Buffer, size_t>> result;
+  // a camera outside the allocated layout (added later to a new scene, beyond the camera count or
+  // larger than the allocated size) gets no fill info until buffers are allocated again
+  // only targets in cameraTargets are filled unless it is empty
+  std::vector<TargetFill> getCameraFillInfo(uint64_t sceneIndex, uint64_t cameraIndex,
+                                            uint32_t frameSlot, uint32_t width, uint32_t height,
+                                            std::vector<std::string> const &cameraTargets) {
+    std::vector<TargetFill> result;
+    if (sceneIndex >= mMaxSceneCount || cameraIndex >= mMaxCameraCount ||
+        width > mMaxCameraWidth || height > mMaxCameraHeight) {
+      return result;
+    }
+    size_t index = (frameSlot * mMaxSceneCount + sceneIndex) * mMaxCameraCount + cameraIndex;
+    if (mPackedLayout) {
+      auto const &entry = mPackedIndexTable.at(index);
+      if (entry[0] < 0 || entry[1] != height || entry[2] != width) {
+        return result;
+      }
+    }
     for (size_t i = 0; i < mRenderTargets.size(); ++i) {
       std::string target = mRenderTargets.at(i);
+      if (cameraTargets.size() &&
+          std::find(cameraTargets.begin(), cameraTargets.end(), target) == cameraTargets.end()) {
+        continue;
+      }
       vk::Buffer buffer = mRenderTargetBuffers.at(i);
-      size_t stride = mRenderTargetStrides.at(i);
-      size_t offset = (sceneIndex * mMaxCameraCount + cameraIndex) * stride;
-      result.push_back({target, buffer, offset});
+      size_t offset = mPackedLayout ? mPackedIndexTable[index][0] * mRenderTargetPixelSizes.at(i)
+                                    : index * mRenderTargetStrides.at(i);
+      result.push_back({target, buffer, offset, mRenderTargetFormats.at(i)});
     }
     return result;
   }
+  size_t mMaxSceneCount{};
   size_t mMaxCameraCount{};
+  uint32_t mMaxCameraWidth{};
+  uint32_t mMaxCameraHeight{};
+  // render target names as the renderer knows them, e.g. Color
   std::vector<std::string> mRenderTargets;
   std::vector<vk::Buffer> mRenderTargetBuffers;
   std::vector<size_t> mRenderTargetStrides{};
+  std::vector<TargetFormat> mRenderTargetFormats{};
+  // packed layout: (pixel offset, height, width) of each frame slot, scene and camera, indexed as
+  // the padded layout; -1 offset marks a camera without a slice
+  bool mPackedLayout{false};
+  std::vector<std::array<int64_t, 3>> mPackedIndexTable;
+  std::vector<size_t> mRenderTargetPixelSizes{};
   // HACK end
+
+  // wait until every queued and submitted frame of all cameras has finished
+  void quiesce();
 };
 
 class VulkanCudaBuffer {
@@ -194,15 +392,39 @@ private:
 
 class RenderServer {
 public:
+  // numRenderThreads = 0 uses one render thread per hardware thread
+  // framesInFlight is the number of frames each camera may have queued or executing at once
+  // numCompletionQueueThreads > 0 serves the per-frame methods from that many completion queues,
+  // 0 serves every method synchronously
+  // scenes with at least parallelPoseThreshold bodies apply poses on the render threads, 0 never
   RenderServer(uint32_t maxNumMaterials, uint32_t maxNumTextures, uint32_t defaultMipLevels,
-               std::string const &device, bool doNotLoadTexture);
+               std::string const &device, bool doNotLoadTexture, uint32_t numRenderThreads,
+               uint32_t framesInFlight, uint32_t numCompletionQueueThreads,
+               uint32_t parallelPoseThreshold);
+  ~RenderServer();
 
   void start(std::string const &address);
   void stop();
 
   // attempt to allocate buffers based on current scenes and cameras
+  // when framesInFlight > 1, buffers get a leading dimension indexed by (frame - 1) % framesInFlight
+  // Calling it again waits for in-flight frames, then sizes new buffers for the current scenes and
+  // cameras and points every camera at them. Render requests arriving meanwhile wait for it. The
+  // previous buffers are released once no caller holds them.
+  // With packed, each buffer is [pixels, channels] and every (frame slot, scene, camera) gets an
+  // exact-size slice; getIndexTable then holds its (pixel offset, height, width).
+  // A target is "name" or "name:type", type being a numpy kind and size with an optional channel
+  // count, e.g. "color:u1" (RGBA8), "color:f2", "segmentation:u2x1" or "depth". Color and
+  // position default to f4, segmentation to i4, all with 4 channels; depth is the single-channel
+  // f4 depth buffer. Segmentation IDs are unsigned, so 1 and 2 byte segmentation buffers are
+  // always u1 or u2.
   // NOTE: it must be not be called concurrently with child processes running!
-  std::vector<VulkanCudaBuffer *> autoAllocateBuffers(std::vector<std::string> renderTargets);
+  std::vector<std::shared_ptr<VulkanCudaBuffer>>
+  autoAllocateBuffers(std::vector<std::string> renderTargets, bool packed);
+
+  // <i8 buffer of [framesInFlight,] maxScene, maxCamera, 3 with the (pixel offset, height, width)
+  // of each packed slice, offset -1 for absent cameras; null unless buffers are packed
+  std::shared_ptr<VulkanCudaBuffer> getIndexTable() const { return mIndexTable; }
 
   bool waitAll(uint64_t timeout);
   bool waitScenes(std::vector<int> const &list, uint64_t timeout);
@@ -210,15 +432,27 @@ public:
   std::string summary() const;
 
 private:
-  VulkanCudaBuffer *allocateBuffer(std::string const &type, std::vector<int> const &shape);
+  std::shared_ptr<VulkanCudaBuffer> allocateBuffer(std::string const &type,
+                                                   std::vector<int> const &shape);
+  // copy size bytes from host memory to the start of buffer and wait for it
+  void uploadBuffer(VulkanCudaBuffer &buffer, void const *data, size_t size);
+
+  std::shared_ptr<svulkan2::core::Context> mContext;
+  std::shared_ptr<svulkan2::resource::SVResourceManager> mResourceManager;
+  std::shared_ptr<WorkStealingThreadPool> mRenderPool;
+  uint32_t mFramesInFlight;
 
   std::unique_ptr<RenderServiceImpl> mService;
   std::unique_ptr<grpc::Server> mServer;
 
-  std::shared_ptr<svulkan2::core::Context> mContext;
-  std::shared_ptr<svulkan2::resource::SVResourceManager> mResourceManager;
+  uint32_t mNumCompletionQueueThreads;
+  std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> mCompletionQueues;
+  std::vector<std::thread> mCompletionQueueThreads;
+
+  uint32_t mParallelPoseThreshold;
 
-  std::vector<std::unique_ptr<VulkanCudaBuffer>> mBuffers;
+  std::vector<std::shared_ptr<VulkanCudaBuffer>> mBuffers;
+  std::shared_ptr<VulkanCudaBuffer> mIndexTable;
 };
 
 } // namespace render_server
@@ -0,0 +1,118 @@
+#include "shared_pose_buffer.h"
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace sapien {
+namespace render_server {
+
+std::unique_ptr<SharedPoseBuffer>
+SharedPoseBuffer::Create(std::string const &name, uint32_t slotCount, uint32_t slotSize) {
+  return std::unique_ptr<SharedPoseBuffer>(new SharedPoseBuffer(name, slotCount, slotSize, true));
+}
+
+std::unique_ptr<SharedPoseBuffer>
+SharedPoseBuffer::Open(std::string const &name, uint32_t slotCount, uint32_t slotSize) {
+  return std::unique_ptr<SharedPoseBuffer>(new SharedPoseBuffer(name, slotCount, slotSize, false));
+}
+
+SharedPoseBuffer::SharedPoseBuffer(std::string const &name, uint32_t slotCount, uint32_t slotSize,
+                                   bool owner)
+    : mName(name), mSlotCount(slotCount), mSlotSize(slotSize), mOwner(owner), mLinked(owner) {
+  if (slotCount == 0) {
+    throw std::runtime_error("shared pose buffer must have at least 1 slot");
+  }
+
+  size_t align = alignof(SlotHeader);
+  mSlotStride = (sizeof(SlotHeader) + slotSize * sizeof(float) + align - 1) / align * align;
+  mSize = sizeof(BufferHeader) + mSlotStride * slotCount;
+
+  int fd = owner ? shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600)
+                 : shm_open(name.c_str(), O_RDONLY, 0);
+  if (fd < 0) {
+    throw std::runtime_error("failed to open shared memory " + name + ": " + strerror(errno));
+  }
+
+  if (owner) {
+    if (ftruncate(fd, mSize) != 0) {
+      int err = errno;
+      close(fd);
+      shm_unlink(name.c_str());
+      throw std::runtime_error("failed to resize shared memory " + name + ": " + strerror(err));
+    }
+  } else {
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) != mSize) {
+      close(fd);
+      throw std::runtime_error("shared memory " + name + " does not match the entity count");
+    }
+  }
+
+  mData = mmap(nullptr, mSize, owner ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+  int err = errno;
+  close(fd);
+  if (mData == MAP_FAILED) {
+    mData = nullptr;
+    if (owner) {
+      shm_unlink(name.c_str());
+    }
+    throw std::runtime_error("failed to map shared memory " + name + ": " + strerror(err));
+  }
+
+  auto header = static_cast<BufferHeader *>(mData);
+  if (owner) {
+    header->slotCount = slotCount;
+    header->slotSize = slotSize;
+  } else if (header->slotCount != slotCount || header->slotSize != slotSize) {
+    munmap(mData, mSize);
+    mData = nullptr;
+    throw std::runtime_error("shared memory " + name + " does not match the entity count");
+  }
+}
+
+SharedPoseBuffer::~SharedPoseBuffer() {
+  if (mData) {
+    munmap(mData, mSize);
+  }
+  unlink();
+}
+
+void SharedPoseBuffer::unlink() {
+  if (mOwner && mLinked) {
+    shm_unlink(mName.c_str());
+    mLinked = false;
+  }
+}
+
+SharedPoseBuffer::SlotHeader *SharedPoseBuffer::getHeader(uint32_t slot) const {
+  if (slot >= mSlotCount) {
+    throw std::out_of_range("shared pose buffer slot out of range");
+  }
+  return reinterpret_cast<SlotHeader *>(static_cast<char *>(mData) + sizeof(BufferHeader) +
+                                        slot * mSlotStride);
+}
+
+float *SharedPoseBuffer::getMutableSlot(uint32_t slot) {
+  if (!mOwner) {
+    throw std::runtime_error("shared pose buffer is read-only");
+  }
+  return reinterpret_cast<float *>(getHeader(slot) + 1);
+}
+
+float const *SharedPoseBuffer::getSlot(uint32_t slot) const {
+  return reinterpret_cast<float const *>(getHeader(slot) + 1);
+}
+
+void SharedPoseBuffer::publish(uint32_t slot, uint64_t frame) {
+  getHeader(slot)->frame.store(frame, std::memory_order_release);
+}
+
+uint64_t SharedPoseBuffer::getFrame(uint32_t slot) const {
+  return getHeader(slot)->frame.load(std::memory_order_acquire);
+}
+
+} // namespace render_server
+} // namespace sapien
@@ -0,0 +1,67 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace sapien {
+namespace render_server {
+
+// A ring of pose slots in POSIX shared memory, used when client and server run on the same host.
+// The client writes the packed poses (7 floats per entity) of a frame into a slot and publishes
+// the frame number; the gRPC request then only carries the (frame, slot) pair and the server reads
+// the poses from its read-only mapping.
+class SharedPoseBuffer {
+public:
+  // create a new segment (client side); fails if the name already exists
+  static std::unique_ptr<SharedPoseBuffer> Create(std::string const &name, uint32_t slotCount,
+                                                  uint32_t slotSize);
+  // map an existing segment read-only (server side); the size must match
+  static std::unique_ptr<SharedPoseBuffer> Open(std::string const &name, uint32_t slotCount,
+                                                uint32_t slotSize);
+
+  SharedPoseBuffer(SharedPoseBuffer const &) = delete;
+  SharedPoseBuffer &operator=(SharedPoseBuffer const &) = delete;
+  ~SharedPoseBuffer();
+
+  float *getMutableSlot(uint32_t slot);
+  float const *getSlot(uint32_t slot) const;
+
+  // mark slot as holding the poses of frame, must be called after the poses are written
+  void publish(uint32_t slot, uint64_t frame);
+  uint64_t getFrame(uint32_t slot) const;
+
+  // remove the name from the system, existing mappings stay valid
+  void unlink();
+
+  inline std::string const &getName() const { return mName; }
+  inline uint32_t getSlotCount() const { return mSlotCount; }
+  // number of floats in a slot
+  inline uint32_t getSlotSize() const { return mSlotSize; }
+
+private:
+  SharedPoseBuffer(std::string const &name, uint32_t slotCount, uint32_t slotSize, bool owner);
+
+  struct alignas(64) BufferHeader {
+    uint32_t slotCount;
+    uint32_t slotSize;
+  };
+  struct alignas(64) SlotHeader {
+    std::atomic<uint64_t> frame;
+  };
+  static_assert(std::atomic<uint64_t>::is_always_lock_free);
+
+  SlotHeader *getHeader(uint32_t slot) const;
+
+  std::string mName;
+  uint32_t mSlotCount;
+  uint32_t mSlotSize;
+  size_t mSlotStride;
+  size_t mSize;
+  void *mData{};
+  bool mOwner;
+  bool mLinked;
+};
+
+} // namespace render_server
+} // namespace sapien
@@ -0,0 +1,177 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sapien {
+namespace render_server {
+
+// Concurrent slot map with generation-checked 64-bit handles.
+//
+// A handle is [tag:8][generation:24][index:32]. The tag tells tables apart so handles of
+// different tables never collide, and it is non-zero so a handle is never 0. Lookups do not lock:
+// they load the slot's current handle and compare it against the requested one, so a stale handle
+// (erased, or its slot reused) is rejected. Slots live in fixed-size chunks that never move, so
+// inserts do not invalidate concurrent lookups. Inserts and erases take a mutex.
+//
+// NOTE: an entry must not be erased while it is being looked up through find or get with the same
+// handle (the server already assumes functions modifying the same scene are not called
+// concurrently). Entries that other callers may erase at any time, e.g. through eraseIf, must be
+// read with copy instead.
+template <typename T> class SlotMap {
+public:
+  explicit SlotMap(uint8_t tag) : mTag(tag) {
+    if (tag == 0) {
+      throw std::invalid_argument("slot map tag must not be 0");
+    }
+  }
+
+  SlotMap(SlotMap const &) = delete;
+  SlotMap &operator=(SlotMap const &) = delete;
+
+  uint64_t insert(T value) {
+    std::lock_guard lock(mMutex);
+    uint32_t index;
+    if (!mFreeList.empty()) {
+      index = mFreeList.front();
+      mFreeList.pop_front();
+    } else {
+      index = mCapacity++;
+      if (index % kChunkSize == 0) {
+        if (index / kChunkSize >= kMaxChunks) {
+          mCapacity--;
+          throw std::runtime_error("slot map is full");
+        }
+        mChunkStorage.push_back(std::make_unique<Slot[]>(kChunkSize));
+        mChunks[index / kChunkSize].store(mChunkStorage.back().get(), std::memory_order_release);
+      }
+    }
+
+    Slot &slot = getSlot(index);
+    slot.value.emplace(std::move(value));
+    uint64_t handle = (static_cast<uint64_t>(mTag) << 56) |
+                      (static_cast<uint64_t>(slot.generation) << 32) | index;
+    slot.handle.store(handle, std::memory_order_release);
+    mSize++;
+    return handle;
+  }
+
+  // nullptr if the handle is stale or does not belong to this map
+  T const *find(uint64_t handle) const {
+    if ((handle >> 56) != mTag) {
+      return nullptr;
+    }
+    uint32_t index = static_cast<uint32_t>(handle);
+    if (index / kChunkSize >= kMaxChunks) {
+      return nullptr;
+    }
+    Slot *chunk = mChunks[index / kChunkSize].load(std::memory_order_acquire);
+    if (!chunk) {
+      return nullptr;
+    }
+    Slot &slot = chunk[index % kChunkSize];
+    if (slot.handle.load(std::memory_order_acquire) != handle) {
+      return nullptr;
+    }
+    return &*slot.value;
+  }
+
+  T const &get(uint64_t handle) const {
+    if (auto value = find(handle)) {
+      return *value;
+    }
+    throw std::out_of_range("invalid handle " + std::to_string(handle));
+  }
+
+  // copy of the value under the mutex, so a concurrent erase cannot free it while it is being
+  // copied; nullopt if the handle is stale or does not belong to this map
+  std::optional<T> copy(uint64_t handle) const {
+    std::lock_guard lock(mMutex);
+    if (auto value = find(handle)) {
+      return *value;
+    }
+    return std::nullopt;
+  }
+
+  bool erase(uint64_t handle) {
+    std::lock_guard lock(mMutex);
+    if (!find(handle)) {
+      return false;
+    }
+    eraseIndex(static_cast<uint32_t>(handle));
+    return true;
+  }
+
+  template <typename Pred> void eraseIf(Pred pred) {
+    std::lock_guard lock(mMutex);
+    for (uint32_t index = 0; index < mCapacity; ++index) {
+      Slot &slot = getSlot(index);
+      if (slot.value && pred(*slot.value)) {
+        eraseIndex(index);
+      }
+    }
+  }
+
+  std::vector<std::pair<uint64_t, T>> flat() const {
+    std::vector<std::pair<uint64_t, T>> result;
+    std::lock_guard lock(mMutex);
+    for (uint32_t index = 0; index < mCapacity; ++index) {
+      Slot &slot = getSlot(index);
+      if (slot.value) {
+        result.push_back({slot.handle.load(std::memory_order_relaxed), *slot.value});
+      }
+    }
+    return result;
+  }
+
+  size_t size() const {
+    std::lock_guard lock(mMutex);
+    return mSize;
+  }
+
+private:
+  static constexpr uint32_t kChunkSize = 1024;
+  static constexpr uint32_t kMaxChunks = 4096;
+  static constexpr uint32_t kGenerationMask = (1u << 24) - 1;
+
+  struct Slot {
+    std::atomic<uint64_t> handle{0};
+    uint32_t generation{0};
+    std::optional<T> value;
+  };
+
+  Slot &getSlot(uint32_t index) const {
+    return mChunks[index / kChunkSize].load(std::memory_order_relaxed)[index % kChunkSize];
+  }
+
+  // requires mMutex
+  void eraseIndex(uint32_t index) {
+    Slot &slot = getSlot(index);
+    slot.handle.store(0, std::memory_order_release);
+    slot.value.reset();
+    slot.generation = (slot.generation + 1) & kGenerationMask;
+    // reuse the oldest free slot first so stale handles stay detectable for as long as possible
+    mFreeList.push_back(index);
+    mSize--;
+  }
+
+  uint8_t mTag;
+
+  mutable std::mutex mMutex;
+  std::array<std::atomic<Slot *>, kMaxChunks> mChunks{};
+  std::vector<std::unique_ptr<Slot[]>> mChunkStorage;
+  std::deque<uint32_t> mFreeList;
+  uint32_t mCapacity{0};
+  size_t mSize{0};
+};
+
+} // namespace render_server
+} // namespace sapien
@@ -0,0 +1,119 @@
+#include "submission_batcher.h"
+#include <algorithm>
+#include <cstdio>
+
+namespace sapien {
+namespace render_server {
+
+SubmissionBatcher::SubmissionBatcher(std::shared_ptr<svulkan2::core::Context> context,
+                                     std::chrono::microseconds deadline, uint32_t maxBatchSize)
+    : mContext(context), mDeadline(deadline), mMaxBatchSize(std::max(maxBatchSize, 1u)) {
+  mDeadlineThread = std::thread(&SubmissionBatcher::run, this);
+}
+
+SubmissionBatcher::~SubmissionBatcher() {
+  {
+    std::lock_guard lock(mMutex);
+    mStop = true;
+  }
+  mCondition.notify_all();
+  mDeadlineThread.join();
+  flush(FlushReason::eDeadline);
+}
+
+void SubmissionBatcher::add(vk::CommandBuffer commandBuffer, vk::Semaphore semaphore,
+                            uint64_t value) {
+  bool full;
+  {
+    std::lock_guard lock(mMutex);
+    if (mPending.empty()) {
+      mFirstPendingTime = std::chrono::steady_clock::now();
+    }
+    mPending.push_back({commandBuffer, semaphore, value});
+    full = mPending.size() >= mMaxBatchSize;
+  }
+  if (full) {
+    flush(FlushReason::eFull);
+  } else {
+    mCondition.notify_one();
+  }
+}
+
+void SubmissionBatcher::flush(FlushReason reason) {
+  std::lock_guard submitLock(mSubmitMutex);
+
+  std::vector<Entry> batch;
+  {
+    std::lock_guard lock(mMutex);
+    batch.swap(mPending);
+  }
+  mCondition.notify_one();
+  if (batch.empty()) {
+    return;
+  }
+
+  // SubmitInfo points into these, they must not reallocate
+  std::vector<vk::TimelineSemaphoreSubmitInfo> timelineInfos;
+  std::vector<vk::SubmitInfo> submitInfos;
+  timelineInfos.reserve(batch.size());
+  submitInfos.reserve(batch.size());
+  for (auto &entry : batch) {
+    auto &timelineInfo = timelineInfos.emplace_back(0, nullptr, 1, &entry.value);
+    submitInfos.emplace_back(0, nullptr, nullptr, 1, &entry.commandBuffer, 1, &entry.semaphore,
+                             &timelineInfo);
+  }
+  mContext->getQueue().submit(submitInfos, {});
+
+  uint64_t size = batch.size();
+  mSubmissions += size;
+  mBatches++;
+  uint64_t maxBatch = mMaxBatch.load();
+  while (size > maxBatch && !mMaxBatch.compare_exchange_weak(maxBatch, size)) {
+  }
+  switch (reason) {
+  case FlushReason::eWave:
+    mWaveFlushes++;
+    break;
+  case FlushReason::eDeadline:
+    mDeadlineFlushes++;
+    break;
+  case FlushReason::eFull:
+    mFullFlushes++;
+    break;
+  case FlushReason::eWait:
+    mWaitFlushes++;
+    break;
+  }
+}
+
+void SubmissionBatcher::run() {
+  std::unique_lock lock(mMutex);
+  while (true) {
+    mCondition.wait(lock, [this] { return mStop || !mPending.empty(); });
+    if (mStop) {
+      return;
+    }
+    // someone else flushed in the meantime, wait for the next batch
+    if (mCondition.wait_until(lock, mFirstPendingTime + mDeadline,
+                              [this] { return mStop || mPending.empty(); })) {
+      continue;
+    }
+
+    lock.unlock();
+    try {
+      flush(FlushReason::eDeadline);
+    } catch (std::exception const &e) {
+      fprintf(stderr, "render server failed to submit: %s\n", e.what());
+    }
+    lock.lock();
+  }
+}
+
+SubmissionBatcher::Stats SubmissionBatcher::getStats() const {
+  return {mSubmissions.load(),     mBatches.load(),     mMaxBatch.load(),
+          mWaveFlushes.load(),     mDeadlineFlushes.load(), mFullFlushes.load(),
+          mWaitFlushes.load(),     mUnbatchedSubmissions.load()};
+}
+
+} // namespace render_server
+} // namespace sapien
@@ -0,0 +1,89 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <svulkan2/core/context.h>
+#include <thread>
+#include <vector>
+
+namespace sapien {
+namespace render_server {
+
+// Collects recorded camera command buffers together with their timeline signal and hands them to
+// the queue in a single vkQueueSubmit with one SubmitInfo per command buffer. Pending submissions
+// are flushed explicitly (end of a render wave, before waiting on a pending frame), when the batch
+// is full, or by a background thread once the oldest submission is older than the deadline.
+// Submissions always reach the queue in the order they were added.
+// Only the copy-out command buffers of cameras go through here: svulkan2's Renderer::render
+// records and submits its own command buffers and has no record-only entry point. Those
+// submissions are counted with countUnbatched so the stats show every vkQueueSubmit of a frame.
+class SubmissionBatcher {
+public:
+  enum class FlushReason { eWave, eDeadline, eFull, eWait };
+
+  struct Stats {
+    uint64_t submissions;
+    uint64_t batches;
+    uint64_t maxBatchSize;
+    uint64_t waveFlushes;
+    uint64_t deadlineFlushes;
+    uint64_t fullFlushes;
+    uint64_t waitFlushes;
+    uint64_t unbatchedSubmissions;
+  };
+
+  SubmissionBatcher(std::shared_ptr<svulkan2::core::Context> context,
+                    std::chrono::microseconds deadline = std::chrono::microseconds(200),
+                    uint32_t maxBatchSize = 256);
+  SubmissionBatcher(SubmissionBatcher const &) = delete;
+  SubmissionBatcher &operator=(SubmissionBatcher const &) = delete;
+  ~SubmissionBatcher();
+
+  // queue commandBuffer to signal semaphore with value when it completes
+  void add(vk::CommandBuffer commandBuffer, vk::Semaphore semaphore, uint64_t value);
+
+  // record a submission made directly to the queue, e.g. by Renderer::render
+  void countUnbatched() { mUnbatchedSubmissions++; }
+
+  // submit everything added so far
+  void flush(FlushReason reason);
+
+  Stats getStats() const;
+
+private:
+  struct Entry {
+    vk::CommandBuffer commandBuffer;
+    vk::Semaphore semaphore;
+    uint64_t value;
+  };
+
+  void run();
+
+  std::shared_ptr<svulkan2::core::Context> mContext;
+  std::chrono::microseconds mDeadline;
+  uint32_t mMaxBatchSize;
+
+  // held for the whole flush so batches reach the queue in order
+  std::mutex mSubmitMutex;
+
+  std::mutex mMutex;
+  std::condition_variable mCondition;
+  std::vector<Entry> mPending;
+  std::chrono::steady_clock::time_point mFirstPendingTime;
+  bool mStop{};
+  std::thread mDeadlineThread;
+
+  std::atomic<uint64_t> mSubmissions{0};
+  std::atomic<uint64_t> mBatches{0};
+  std::atomic<uint64_t> mMaxBatch{0};
+  std::atomic<uint64_t> mWaveFlushes{0};
+  std::atomic<uint64_t> mDeadlineFlushes{0};
+  std::atomic<uint64_t> mFullFlushes{0};
+  std::atomic<uint64_t> mWaitFlushes{0};
+  std::atomic<uint64_t> mUnbatchedSubmissions{0};
+};
+
+} // namespace render_server
+} // namespace sapien
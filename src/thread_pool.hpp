@@ -4,7 +4,12 @@
 #include <mutex>
 #include <queue>
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <functional>
+#include <memory>
 #include <future>
 #include <thread>
 #include <utility>
@@ -107,4 +112,244 @@ public:
 
   bool running() const { return m_init; }
 };
+
+// Thread pool with one task deque per worker. A worker pops from the back of its own deque and
+// steals from the front of the others when it runs dry. Tasks submitted from a worker go to that
+// worker's deque, other submissions are distributed round robin.
+class WorkStealingThreadPool {
+private:
+  struct WorkerQueue {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  bool m_init;
+  std::atomic<bool> m_shutdown;
+  std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+  std::vector<std::thread> m_threads;
+  std::atomic<uint32_t> m_next;
+
+  // Tasks posted and not yet popped. It is incremented before a task is pushed, so a stolen task
+  // is always counted. Workers only take m_mutex to sleep, and posts only to wake a sleeper.
+  std::atomic<int64_t> m_pending;
+  std::atomic<uint32_t> m_sleeping;
+  std::mutex m_mutex;
+  std::condition_variable m_conditional_lock;
+
+  static inline thread_local WorkStealingThreadPool *t_pool = nullptr;
+  static inline thread_local uint32_t t_index = 0;
+
+  bool pop(uint32_t id, std::function<void()> &func) {
+    uint32_t n = m_queues.size();
+    for (uint32_t i = 0; i < n; ++i) {
+      auto &queue = *m_queues[(id + i) % n];
+      std::lock_guard lock(queue.mutex);
+      if (queue.tasks.empty()) {
+        continue;
+      }
+      if (i == 0) {
+        func = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+      } else {
+        func = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+      }
+      return true;
+    }
+    return false;
+  }
+
+  void work(uint32_t id) {
+    t_pool = this;
+    t_index = id;
+    std::function<void()> func;
+    while (true) {
+      if (pop(id, func)) {
+        m_pending--;
+        func();
+        continue;
+      }
+      int64_t pending = m_pending;
+      if (pending > 0) {
+        // counted but not pushed yet
+        std::this_thread::yield();
+        continue;
+      }
+      if (m_shutdown) {
+        return;
+      }
+
+      // a post either sees this sleeper and wakes it under the lock, or its count is seen here
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_sleeping++;
+      m_conditional_lock.wait(lock, [this] { return m_pending > 0 || m_shutdown; });
+      m_sleeping--;
+    }
+  }
+
+public:
+  // n_threads = 0 uses one thread per hardware thread
+  WorkStealingThreadPool(const int n_threads)
+      : m_init(false), m_shutdown(false), m_next(0), m_pending(0), m_sleeping(0) {
+    uint32_t n = n_threads > 0 ? n_threads : std::max(1u, std::thread::hardware_concurrency());
+    for (uint32_t i = 0; i < n; ++i) {
+      m_queues.push_back(std::make_unique<WorkerQueue>());
+    }
+    m_threads.resize(n);
+  }
+
+  WorkStealingThreadPool(const WorkStealingThreadPool &) = delete;
+  WorkStealingThreadPool(WorkStealingThreadPool &&) = delete;
+
+  WorkStealingThreadPool &operator=(const WorkStealingThreadPool &) = delete;
+  WorkStealingThreadPool &operator=(WorkStealingThreadPool &&) = delete;
+
+  ~WorkStealingThreadPool() { shutdown(); }
+
+  void init() {
+    m_init = true;
+    for (uint32_t i = 0; i < m_threads.size(); ++i) {
+      m_threads[i] = std::thread(&WorkStealingThreadPool::work, this, i);
+    }
+  }
+
+  // Runs the tasks still queued, including those they post, then stops the threads
+  void shutdown() {
+    {
+      std::lock_guard lock(m_mutex);
+      m_shutdown = true;
+    }
+    m_conditional_lock.notify_all();
+
+    for (uint32_t i = 0; i < m_threads.size(); ++i) {
+      if (m_threads[i].joinable()) {
+        m_threads[i].join();
+      }
+    }
+  }
+
+  // Enqueue a function without a future, exceptions must not escape it
+  void post(std::function<void()> func) {
+    uint32_t id = t_pool == this ? t_index : m_next++ % m_queues.size();
+    m_pending++;
+    {
+      std::lock_guard lock(m_queues[id]->mutex);
+      m_queues[id]->tasks.push_back(std::move(func));
+    }
+    if (m_sleeping > 0) {
+      // the lock orders this wake after the sleeper's check of m_pending
+      std::lock_guard lock(m_mutex);
+      m_conditional_lock.notify_one();
+    }
+  }
+
+  // Submit a function to be executed asynchronously by the pool
+  template <typename F, typename... Args>
+  auto submit(F &&f, Args &&...args) -> std::future<decltype(f(args...))> {
+    std::function<decltype(f(args...))()> func =
+        std::bind(std::forward<F>(f), std::forward<Args>(args)...);
+    auto task_ptr = std::make_shared<std::packaged_task<decltype(f(args...))()>>(func);
+    post([task_ptr]() { (*task_ptr)(); });
+    return task_ptr->get_future();
+  }
+
+  // Run func(begin, end) over [0, count) in chunks of at most grain elements and return when all
+  // chunks are done. The calling thread claims chunks too, so a worker may call this without
+  // deadlocking. func must not throw.
+  void parallelFor(size_t count, size_t grain, std::function<void(size_t, size_t)> const &func) {
+    size_t chunks = (count + grain - 1) / grain;
+    if (chunks <= 1) {
+      if (count) {
+        func(0, count);
+      }
+      return;
+    }
+
+    struct State {
+      std::atomic<size_t> next{0};
+      size_t done{0};
+      std::mutex mutex;
+      std::condition_variable cv;
+    };
+    auto state = std::make_shared<State>();
+    // helpers that start after every chunk is claimed return without touching func
+    auto run = [state, chunks, count, grain, &func]() {
+      size_t finished = 0;
+      for (size_t c; (c = state->next++) < chunks; ++finished) {
+        func(c * grain, std::min(count, (c + 1) * grain));
+      }
+      if (finished) {
+        std::lock_guard lock(state->mutex);
+        state->done += finished;
+        if (state->done == chunks) {
+          state->cv.notify_all();
+        }
+      }
+    };
+
+    size_t helpers = std::min<size_t>(chunks - 1, m_queues.size());
+    for (size_t i = 0; i < helpers; ++i) {
+      post(run);
+    }
+    run();
+
+    std::unique_lock lock(state->mutex);
+    state->cv.wait(lock, [&] { return state->done == chunks; });
+  }
+
+  uint32_t size() const { return m_threads.size(); }
+  bool running() const { return m_init; }
+};
+
+// Runs tasks on a shared WorkStealingThreadPool one at a time and in submission order. At most one
+// task of an executor is queued on the pool at any time, so executors do not hog workers.
+class SerialExecutor : public std::enable_shared_from_this<SerialExecutor> {
+private:
+  WorkStealingThreadPool &m_pool;
+  std::mutex m_mutex;
+  std::queue<std::function<void()>> m_queue;
+  bool m_scheduled;
+
+  void runNext() {
+    std::function<void()> func;
+    {
+      std::lock_guard lock(m_mutex);
+      func = std::move(m_queue.front());
+      m_queue.pop();
+    }
+    func();
+    {
+      std::lock_guard lock(m_mutex);
+      if (m_queue.empty()) {
+        m_scheduled = false;
+        return;
+      }
+    }
+    m_pool.post([self = shared_from_this()]() { self->runNext(); });
+  }
+
+public:
+  // must be owned by a shared_ptr
+  SerialExecutor(WorkStealingThreadPool &pool) : m_pool(pool), m_scheduled(false) {}
+
+  SerialExecutor(const SerialExecutor &) = delete;
+  SerialExecutor &operator=(const SerialExecutor &) = delete;
+
+  template <typename F, typename... Args>
+  auto submit(F &&f, Args &&...args) -> std::future<decltype(f(args...))> {
+    std::function<decltype(f(args...))()> func =
+        std::bind(std::forward<F>(f), std::forward<Args>(args)...);
+    auto task_ptr = std::make_shared<std::packaged_task<decltype(f(args...))()>>(func);
+    {
+      std::lock_guard lock(m_mutex);
+      m_queue.push([task_ptr]() { (*task_ptr)(); });
+      if (m_scheduled) {
+        return task_ptr->get_future();
+      }
+      m_scheduled = true;
+    }
+    m_pool.post([self = shared_from_this()]() { self->runNext(); });
+    return task_ptr->get_future();
+  }
+};
 } // namespace sapien
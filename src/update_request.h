@@ -0,0 +1,33 @@
+#pragma once
+#include "proto/render_server.pb.h"
+
+namespace sapien {
+namespace render_server {
+
+// Clearing of the update requests a client reuses for every step.
+//
+// Clear on an arena message does not keep its singular submessages: protobuf nulls the pointer and
+// leaves the memory to the arena, so the next mutable_update() or mutable_pose_slot() allocates a
+// new one that is only freed with the arena. These clear such submessages in place instead.
+// pose_slot is kept only when the scene uses the shared pose buffer, because a present pose_slot
+// tells the server to read the poses from it.
+
+template <typename Req> void clearUpdateRequest(Req &req, bool keepPoseSlot) {
+  proto::PoseSlot *slot = nullptr;
+  if (keepPoseSlot && req.has_pose_slot()) {
+    slot = req.unsafe_arena_release_pose_slot();
+  }
+  req.Clear();
+  if (slot) {
+    slot->Clear();
+    req.unsafe_arena_set_allocated_pose_slot(slot);
+  }
+}
+
+inline void clearStepRequest(proto::StepReq &req, bool keepPoseSlot) {
+  req.clear_frame();
+  clearUpdateRequest(*req.mutable_update(), keepPoseSlot);
+}
+
+} // namespace render_server
+} // namespace sapien
@@ -0,0 +1,114 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace sapien {
+namespace render_server {
+
+// Cache of shared values by key, holding them only while someone else does.
+//
+// get returns the value loaded for a key and version, loading it when there is none or its
+// version changed. Concurrent requests for a key that is being loaded wait for that load and share
+// its value or exception. The cache keeps only a weak reference, so a value is freed once its last
+// user lets go, and the next request loads it again.
+template <typename Key, typename Version, typename T> class WeakCache {
+public:
+  template <typename Load>
+  std::shared_ptr<T> get(Key const &key, Version const &version, Load load) {
+    std::promise<std::shared_ptr<T>> promise;
+    std::shared_future<std::shared_ptr<T>> future;
+    uint64_t loadId = 0;
+    {
+      std::lock_guard lock(mMutex);
+      auto it = mEntries.find(key);
+      if (it != mEntries.end() && it->second.version == version) {
+        if (auto value = it->second.value.lock()) {
+          mHits++;
+          return value;
+        }
+        future = it->second.loading;
+      }
+      if (!future.valid()) {
+        pruneExpired();
+        future = promise.get_future().share();
+        loadId = ++mLoadCount;
+        mEntries[key] = {version, {}, future, loadId};
+      }
+    }
+
+    if (!loadId) {
+      mHits++;
+      return future.get();
+    }
+
+    mMisses++;
+    std::shared_ptr<T> value;
+    try {
+      value = load();
+    } catch (...) {
+      promise.set_exception(std::current_exception());
+      std::lock_guard lock(mMutex);
+      auto it = mEntries.find(key);
+      if (it != mEntries.end() && it->second.loadId == loadId) {
+        mEntries.erase(it);
+      }
+      throw;
+    }
+    promise.set_value(value);
+
+    // waiters hold their own copy of the future, the entry must not keep the value alive
+    std::lock_guard lock(mMutex);
+    auto it = mEntries.find(key);
+    if (it != mEntries.end() && it->second.loadId == loadId) {
+      it->second.value = value;
+      it->second.loading = {};
+    }
+    return value;
+  }
+
+  // values alive or being loaded
+  size_t size() {
+    std::lock_guard lock(mMutex);
+    size_t count = 0;
+    for (auto const &kv : mEntries) {
+      count += kv.second.loading.valid() || !kv.second.value.expired();
+    }
+    return count;
+  }
+
+  uint64_t getHitCount() const { return mHits; }
+  uint64_t getMissCount() const { return mMisses; }
+
+private:
+  struct Entry {
+    Version version;
+    std::weak_ptr<T> value;
+    std::shared_future<std::shared_ptr<T>> loading;
+    uint64_t loadId;
+  };
+
+  // drop entries whose value has been freed, called with the mutex held
+  void pruneExpired() {
+    for (auto it = mEntries.begin(); it != mEntries.end();) {
+      if (!it->second.loading.valid() && it->second.value.expired()) {
+        it = mEntries.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  std::mutex mMutex;
+  std::unordered_map<Key, Entry> mEntries;
+  uint64_t mLoadCount{0};
+
+  std::atomic<uint64_t> mHits{0};
+  std::atomic<uint64_t> mMisses{0};
+};
+
+} // namespace render_server
+} // namespace sapien
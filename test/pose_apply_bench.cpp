@@ -0,0 +1,49 @@
+#include "pose_apply.h"
+#include <benchmark/benchmark.h>
+#include <cmath>
+
+using namespace sapien;
+using namespace sapien::render_server;
+
+struct FakeNode {
+  glm::vec3 getScale() const { return {1.f, 1.f, 1.f}; }
+};
+
+// one update of a large scene where every pose changed, on pools of 0 (serial) to 8 threads
+static void BM_ApplyPoses(benchmark::State &state) {
+  size_t count = state.range(0);
+  int threads = state.range(1);
+  std::vector<FakeNode> storage(count);
+  std::vector<FakeNode *> nodes;
+  for (auto &node : storage) {
+    nodes.push_back(&node);
+  }
+  std::vector<std::array<float, 7>> lastPoses(count);
+  std::vector<float> poses(7 * count, 0.f);
+  BasicDirtyNodes<FakeNode> dirty;
+  std::vector<BasicDirtyNodes<FakeNode>> chunks;
+  WorkStealingThreadPool pool(std::max(threads, 1));
+  pool.init();
+
+  float frame = 0.f;
+  for (auto _ : state) {
+    state.PauseTiming();
+    frame += 1.f;
+    for (size_t i = 0; i < count; ++i) {
+      poses[7 * i] = frame;
+    }
+    dirty.clear();
+    state.ResumeTiming();
+    if (threads) {
+      applyPosesParallel(poses.data(), count, nodes.data(), lastPoses.data(), dirty, chunks, pool);
+    } else {
+      applyPoses(poses.data(), count, nodes.data(), lastPoses.data(), dirty);
+    }
+    benchmark::DoNotOptimize(dirty.nodes.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_ApplyPoses)
+    ->ArgNames({"poses", "threads"})
+    ->ArgsProduct({{16384, 131072}, {0, 1, 2, 4, 8}})
+    ->UseRealTime();
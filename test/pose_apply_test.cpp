@@ -0,0 +1,160 @@
+#include "pose_apply.h"
+#include <cmath>
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace sapien;
+using namespace sapien::render_server;
+
+struct FakeNode {
+  glm::vec3 scale;
+  glm::vec3 getScale() const { return scale; }
+};
+
+using FakeDirtyNodes = BasicDirtyNodes<FakeNode>;
+
+struct FakeScene {
+  std::vector<FakeNode> storage;
+  std::vector<FakeNode *> nodes;
+  std::vector<std::array<float, 7>> lastPoses;
+
+  explicit FakeScene(size_t count) : storage(count), lastPoses(count) {
+    for (size_t i = 0; i < count; ++i) {
+      storage[i].scale = {1.f + i, 2.f, 3.f};
+      nodes.push_back(&storage[i]);
+      lastPoses[i].fill(NAN);
+    }
+  }
+};
+
+static std::vector<float> randomPoses(size_t count, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> value(-1.f, 1.f);
+  std::vector<float> poses(7 * count);
+  for (auto &v : poses) {
+    v = value(rng);
+  }
+  return poses;
+}
+
+static void expectSameDirtyNodes(FakeDirtyNodes &serial, FakeDirtyNodes &parallel) {
+  ASSERT_EQ(serial.nodes, parallel.nodes);
+  ASSERT_EQ(serial.poses.px, parallel.poses.px);
+  ASSERT_EQ(serial.poses.qw, parallel.poses.qw);
+  ASSERT_EQ(serial.poses.qz, parallel.poses.qz);
+  ASSERT_EQ(serial.poses.sx, parallel.poses.sx);
+}
+
+// more than one chunk, the last one partial; chunk c must write nodes of chunk c
+TEST(PoseApply, ParallelMatchesSerial) {
+  constexpr size_t kCount = 4 * kPoseChunkSize + 123;
+  WorkStealingThreadPool pool(4);
+  pool.init();
+
+  FakeScene serialScene(kCount), parallelScene(kCount);
+  FakeDirtyNodes serial, parallel;
+  std::vector<FakeDirtyNodes> chunks;
+
+  auto poses = randomPoses(kCount, 1);
+  applyPoses(poses.data(), kCount, serialScene.nodes.data(), serialScene.lastPoses.data(),
+             serial);
+  applyPosesParallel(poses.data(), kCount, parallelScene.nodes.data(),
+                     parallelScene.lastPoses.data(), parallel, chunks, pool);
+
+  ASSERT_EQ(serial.nodes.size(), kCount);
+  // nodes differ between the scenes, compare their indices
+  for (size_t i = 0; i < kCount; ++i) {
+    ASSERT_EQ(serial.nodes[i] - serialScene.storage.data(), static_cast<ptrdiff_t>(i));
+    ASSERT_EQ(parallel.nodes[i] - parallelScene.storage.data(), static_cast<ptrdiff_t>(i));
+  }
+  ASSERT_EQ(serialScene.lastPoses, parallelScene.lastPoses);
+  serial.nodes = parallel.nodes;
+  expectSameDirtyNodes(serial, parallel);
+
+  // a second update that moves every third node only marks those
+  serial.clear();
+  parallel.clear();
+  for (size_t i = 0; i < kCount; i += 3) {
+    poses[7 * i] += 1.f;
+  }
+  applyPoses(poses.data(), kCount, serialScene.nodes.data(), serialScene.lastPoses.data(),
+             serial);
+  applyPosesParallel(poses.data(), kCount, parallelScene.nodes.data(),
+                     parallelScene.lastPoses.data(), parallel, chunks, pool);
+  ASSERT_EQ(parallel.nodes.size(), (kCount + 2) / 3);
+  for (size_t k = 0; k < parallel.nodes.size(); ++k) {
+    ASSERT_EQ(parallel.nodes[k] - parallelScene.storage.data(), static_cast<ptrdiff_t>(3 * k));
+    ASSERT_EQ(serial.nodes[k] - serialScene.storage.data(), static_cast<ptrdiff_t>(3 * k));
+  }
+  serial.nodes = parallel.nodes;
+  expectSameDirtyNodes(serial, parallel);
+  ASSERT_EQ(serialScene.lastPoses, parallelScene.lastPoses);
+}
+
+TEST(PoseApply, UnchangedPoseIsNotDirty) {
+  FakeScene scene(2);
+  FakeDirtyNodes dirty;
+  auto poses = randomPoses(2, 2);
+  applyPoses(poses.data(), 2, scene.nodes.data(), scene.lastPoses.data(), dirty);
+  EXPECT_EQ(dirty.nodes.size(), 2u);
+  EXPECT_EQ(dirty.poses.sx[1], 2.f);
+
+  dirty.clear();
+  applyPoses(poses.data(), 2, scene.nodes.data(), scene.lastPoses.data(), dirty);
+  EXPECT_TRUE(dirty.nodes.empty());
+  EXPECT_EQ(dirty.poses.size(), 0u);
+}
+
+// a scene whose every node has been posed once, with nothing dirty
+static FakeScene posedScene(size_t count, FakeDirtyNodes &dirty) {
+  FakeScene scene(count);
+  auto poses = randomPoses(count, 3);
+  applyPoses(poses.data(), count, scene.nodes.data(), scene.lastPoses.data(), dirty);
+  dirty.clear();
+  return scene;
+}
+
+TEST(PoseApply, SparsePosesApplyListedNodes) {
+  FakeDirtyNodes dirty;
+  auto scene = posedScene(8, dirty);
+  auto before = scene.lastPoses;
+
+  std::vector<uint32_t> indices = {5, 1};
+  auto poses = randomPoses(2, 4);
+  applySparsePoses(poses.data(), indices.data(), indices.size(), scene.nodes.data(),
+                   scene.nodes.size(), scene.lastPoses.data(), dirty);
+
+  ASSERT_EQ(dirty.nodes.size(), 2u);
+  EXPECT_EQ(dirty.nodes[0], &scene.storage[5]);
+  EXPECT_EQ(dirty.nodes[1], &scene.storage[1]);
+  EXPECT_EQ(scene.lastPoses[5][0], poses[0]);
+  EXPECT_EQ(scene.lastPoses[1][0], poses[7]);
+  for (size_t i : {0, 2, 3, 4, 6, 7}) {
+    EXPECT_EQ(scene.lastPoses[i], before[i]);
+  }
+}
+
+// the client resends every pose after a rejected update, so nothing of it may be applied
+TEST(PoseApply, RejectedSparsePosesChangeNothing) {
+  FakeDirtyNodes dirty;
+  auto scene = posedScene(8, dirty);
+  auto before = scene.lastPoses;
+
+  for (auto indices : {std::vector<uint32_t>{2, 3, 8}, std::vector<uint32_t>{2, 3, 2}}) {
+    auto poses = randomPoses(indices.size(), 5);
+    EXPECT_THROW(applySparsePoses(poses.data(), indices.data(), indices.size(),
+                                  scene.nodes.data(), scene.nodes.size(), scene.lastPoses.data(),
+                                  dirty),
+                 std::invalid_argument);
+    EXPECT_TRUE(dirty.nodes.empty());
+    EXPECT_EQ(dirty.poses.size(), 0u);
+    EXPECT_EQ(scene.lastPoses, before);
+  }
+
+  // the indices checked before the failure do not count as repeated in the next update
+  std::vector<uint32_t> indices = {2, 3};
+  auto poses = randomPoses(2, 6);
+  applySparsePoses(poses.data(), indices.data(), indices.size(), scene.nodes.data(),
+                   scene.nodes.size(), scene.lastPoses.data(), dirty);
+  EXPECT_EQ(dirty.nodes.size(), 2u);
+}
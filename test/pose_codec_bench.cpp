@@ -0,0 +1,41 @@
+#include "pose_codec.h"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using namespace sapien::render_server;
+
+static std::vector<float> identityPoses(size_t count) {
+  std::vector<float> poses(7 * count, 0.f);
+  for (size_t i = 0; i < count; ++i) {
+    poses[7 * i] = 0.001f * i;
+    poses[7 * i + 3] = 1.f;
+  }
+  return poses;
+}
+
+static void BM_EncodePoses(benchmark::State &state) {
+  size_t count = state.range(0);
+  auto poses = identityPoses(count);
+  std::vector<uint8_t> data(getQuantizedPosesSize(count));
+  PoseQuantization quantization;
+  for (auto _ : state) {
+    encodePoses(poses.data(), count, quantization, data.data());
+    benchmark::DoNotOptimize(data.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_EncodePoses)->Arg(1024)->Arg(16384)->Arg(100000);
+
+static void BM_DecodePoses(benchmark::State &state) {
+  size_t count = state.range(0);
+  auto poses = identityPoses(count);
+  std::vector<uint8_t> data(getQuantizedPosesSize(count));
+  PoseQuantization quantization;
+  encodePoses(poses.data(), count, quantization, data.data());
+  for (auto _ : state) {
+    decodePoses(data.data(), count, quantization, poses.data());
+    benchmark::DoNotOptimize(poses.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_DecodePoses)->Arg(1024)->Arg(16384)->Arg(100000);
@@ -0,0 +1,142 @@
+#include "pose_codec.h"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using namespace sapien::render_server;
+
+// count random poses with unit quaternions and positions within the range of quantization
+static std::vector<float> randomPoses(size_t count, PoseQuantization const &quantization,
+                                      uint32_t seed) {
+  std::mt19937 rng(seed);
+  float range = 32767.f * quantization.positionStep;
+  std::uniform_real_distribution<float> position(-range, range);
+  std::normal_distribution<float> normal;
+
+  std::vector<float> poses(7 * count);
+  for (size_t i = 0; i < count; ++i) {
+    float *pose = poses.data() + 7 * i;
+    for (int k = 0; k < 3; ++k) {
+      pose[k] = quantization.origin[k] + position(rng);
+    }
+    float norm = 0.f;
+    for (int k = 3; k < 7; ++k) {
+      pose[k] = normal(rng);
+      norm += pose[k] * pose[k];
+    }
+    norm = std::sqrt(norm);
+    for (int k = 3; k < 7; ++k) {
+      pose[k] /= norm;
+    }
+  }
+  return poses;
+}
+
+static std::vector<float> roundTrip(std::vector<float> const &poses,
+                                    PoseQuantization const &quantization) {
+  size_t count = poses.size() / 7;
+  std::vector<uint8_t> data(getQuantizedPosesSize(count));
+  encodePoses(poses.data(), count, quantization, data.data());
+  std::vector<float> decoded(poses.size());
+  decodePoses(data.data(), count, quantization, decoded.data());
+  return decoded;
+}
+
+TEST(PoseCodec, Size) { EXPECT_EQ(getQuantizedPosesSize(3), 30u); }
+
+TEST(PoseCodec, PositionWithinHalfStep) {
+  PoseQuantization quantization;
+  quantization.origin[0] = 1.f;
+  quantization.origin[1] = -2.f;
+  quantization.origin[2] = 0.5f;
+  quantization.positionStep = 1.f / 1024.f;
+
+  auto poses = randomPoses(100000, quantization, 1);
+  auto decoded = roundTrip(poses, quantization);
+  for (size_t i = 0; i < poses.size(); i += 7) {
+    for (int k = 0; k < 3; ++k) {
+      // float rounding of origin + v * step adds a few ulp at |p| ~ 34
+      ASSERT_NEAR(decoded[i + k], poses[i + k], quantization.positionStep / 2.f + 1e-5f);
+    }
+  }
+}
+
+TEST(PoseCodec, PositionClampedOutsideRange) {
+  PoseQuantization quantization;
+  std::vector<float> poses{100.f, -100.f, 0.f, 1.f, 0.f, 0.f, 0.f};
+  auto decoded = roundTrip(poses, quantization);
+  EXPECT_FLOAT_EQ(decoded[0], 32767.f * quantization.positionStep);
+  EXPECT_FLOAT_EQ(decoded[1], -32767.f * quantization.positionStep);
+  EXPECT_FLOAT_EQ(decoded[2], 0.f);
+}
+
+TEST(PoseCodec, QuaternionWithinBounds) {
+  PoseQuantization quantization;
+  auto poses = randomPoses(100000, quantization, 2);
+  auto decoded = roundTrip(poses, quantization);
+
+  constexpr float kStoredBound = 6.92e-4f;
+  constexpr float kRecomputedBound = 2e-3f;
+  for (size_t i = 0; i < poses.size(); i += 7) {
+    float const *q = poses.data() + i + 3;
+    float const *d = decoded.data() + i + 3;
+    int largest = 0;
+    for (int k = 1; k < 4; ++k) {
+      largest = std::fabs(q[k]) > std::fabs(q[largest]) ? k : largest;
+    }
+    // the codec returns the representative with a positive largest component
+    float sign = q[largest] < 0.f ? -1.f : 1.f;
+    for (int k = 0; k < 4; ++k) {
+      ASSERT_NEAR(d[k], sign * q[k], k == largest ? kRecomputedBound : kStoredBound)
+          << "pose " << i / 7 << " component " << k;
+    }
+  }
+}
+
+TEST(PoseCodec, IdentityStaysClose) {
+  PoseQuantization quantization;
+  std::vector<float> poses{0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f};
+  auto decoded = roundTrip(poses, quantization);
+  // 0 falls between two of the 1024 levels, so the stored components are off by half a level
+  EXPECT_NEAR(decoded[3], 1.f, 1e-5f);
+  for (int k = 4; k < 7; ++k) {
+    EXPECT_NEAR(decoded[k], 0.f, 1e-3f);
+  }
+}
+
+// the AVX2 paths cover multiples of 8 poses and the scalar path the rest, both must agree
+TEST(PoseCodec, VectorMatchesScalar) {
+  PoseQuantization quantization;
+  quantization.origin[1] = 3.f;
+  constexpr size_t kCount = 1003;
+  auto poses = randomPoses(kCount, quantization, 3);
+
+  std::vector<uint8_t> data(getQuantizedPosesSize(kCount)), scalarData(data.size());
+  encodePoses(poses.data(), kCount, quantization, data.data());
+  encodePosesScalar(poses.data(), kCount, 0, quantization, scalarData.data());
+  ASSERT_EQ(data, scalarData);
+
+  std::vector<float> decoded(poses.size()), scalarDecoded(poses.size());
+  decodePoses(data.data(), kCount, quantization, decoded.data());
+  decodePosesScalar(data.data(), kCount, 0, quantization, scalarDecoded.data());
+  ASSERT_EQ(decoded, scalarDecoded);
+}
+
+// protobuf bytes carry no alignment guarantee
+TEST(PoseCodec, UnalignedBlock) {
+  PoseQuantization quantization;
+  constexpr size_t kCount = 37;
+  auto poses = randomPoses(kCount, quantization, 4);
+  std::vector<uint8_t> aligned(getQuantizedPosesSize(kCount));
+  encodePoses(poses.data(), kCount, quantization, aligned.data());
+
+  std::vector<uint8_t> buffer(aligned.size() + 1);
+  encodePoses(poses.data(), kCount, quantization, buffer.data() + 1);
+  ASSERT_TRUE(std::equal(aligned.begin(), aligned.end(), buffer.begin() + 1));
+
+  std::vector<float> decoded(poses.size()), unalignedDecoded(poses.size());
+  decodePoses(aligned.data(), kCount, quantization, decoded.data());
+  decodePoses(buffer.data() + 1, kCount, quantization, unalignedDecoded.data());
+  EXPECT_EQ(decoded, unalignedDecoded);
+}
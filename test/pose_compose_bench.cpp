@@ -0,0 +1,33 @@
+#include "pose_compose.h"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using namespace sapien::render_server;
+
+// shapes of 4 per body, with identity rotations since the arithmetic does not depend on values
+template <bool Scalar> static void BM_ComposeShapePoses(benchmark::State &state) {
+  size_t count = state.range(0);
+  std::vector<float> bodyPoses(7 * (count / 4 + 1), 0.f);
+  std::vector<float> localPoses(7 * count, 0.f);
+  std::vector<uint32_t> bodies(count);
+  for (size_t i = 0; i < count; ++i) {
+    bodies[i] = static_cast<uint32_t>(i / 4);
+    localPoses[7 * i + 3] = 1.f;
+  }
+  for (size_t i = 0; i < bodyPoses.size(); i += 7) {
+    bodyPoses[i + 3] = 1.f;
+  }
+  std::vector<float> out(7 * count);
+  for (auto _ : state) {
+    if (Scalar) {
+      composeShapePosesScalar(bodyPoses.data(), bodies.data(), localPoses.data(), count, 0,
+                              out.data());
+    } else {
+      composeShapePoses(bodyPoses.data(), bodies.data(), localPoses.data(), count, out.data());
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK_TEMPLATE(BM_ComposeShapePoses, true)->Arg(1000)->Arg(10000)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_ComposeShapePoses, false)->Arg(1000)->Arg(10000)->Arg(100000);
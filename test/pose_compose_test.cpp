@@ -0,0 +1,99 @@
+#include "pose_compose.h"
+#include <cmath>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using namespace sapien::render_server;
+
+// count random poses with unit quaternions
+static std::vector<float> randomPoses(size_t count, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> position(-10.f, 10.f);
+  std::normal_distribution<float> normal;
+  std::vector<float> poses(7 * count);
+  for (size_t i = 0; i < count; ++i) {
+    float *pose = poses.data() + 7 * i;
+    for (int k = 0; k < 3; ++k) {
+      pose[k] = position(rng);
+    }
+    float norm = 0.f;
+    for (int k = 3; k < 7; ++k) {
+      pose[k] = normal(rng);
+      norm += pose[k] * pose[k];
+    }
+    for (int k = 3; k < 7; ++k) {
+      pose[k] /= std::sqrt(norm);
+    }
+  }
+  return poses;
+}
+
+// shapes in body order with a few shapes per body, as ClientSystem lays them out
+static std::vector<uint32_t> shapeBodies(size_t shapeCount, size_t bodyCount) {
+  std::vector<uint32_t> bodies(shapeCount);
+  for (size_t i = 0; i < shapeCount; ++i) {
+    bodies[i] = static_cast<uint32_t>(i * bodyCount / shapeCount);
+  }
+  return bodies;
+}
+
+// Hamilton product of quaternions w x y z
+static void multiply(double const *a, double const *b, double *out) {
+  out[0] = a[0] * b[0] - a[1] * b[1] - a[2] * b[2] - a[3] * b[3];
+  out[1] = a[0] * b[1] + a[1] * b[0] + a[2] * b[3] - a[3] * b[2];
+  out[2] = a[0] * b[2] - a[1] * b[3] + a[2] * b[0] + a[3] * b[1];
+  out[3] = a[0] * b[3] + a[1] * b[2] - a[2] * b[1] + a[3] * b[0];
+}
+
+// what Pose::operator* computes, in double and with the rotation as qb (0, pl) qb^-1
+static void composeReference(float const *b, float const *l, double *o) {
+  double qb[4] = {b[3], b[4], b[5], b[6]};
+  double conj[4] = {b[3], -b[4], -b[5], -b[6]};
+  double pl[4] = {0.0, l[0], l[1], l[2]};
+  double ql[4] = {l[3], l[4], l[5], l[6]};
+  double half[4], rotated[4];
+  multiply(qb, pl, half);
+  multiply(half, conj, rotated);
+  for (int k = 0; k < 3; ++k) {
+    o[k] = b[k] + rotated[k + 1];
+  }
+  multiply(qb, ql, o + 3);
+}
+
+TEST(PoseCompose, MatchesPoseProduct) {
+  // not a multiple of 8, so the vector path leaves a scalar tail
+  size_t shapeCount = 1003;
+  size_t bodyCount = 300;
+  auto bodyPoses = randomPoses(bodyCount, 1);
+  auto localPoses = randomPoses(shapeCount, 2);
+  auto bodies = shapeBodies(shapeCount, bodyCount);
+
+  std::vector<float> out(7 * shapeCount);
+  composeShapePoses(bodyPoses.data(), bodies.data(), localPoses.data(), shapeCount, out.data());
+
+  for (size_t i = 0; i < shapeCount; ++i) {
+    double expected[7];
+    composeReference(bodyPoses.data() + 7 * bodies[i], localPoses.data() + 7 * i, expected);
+    for (int k = 0; k < 7; ++k) {
+      EXPECT_NEAR(out[7 * i + k], expected[k], 1e-5f) << "shape " << i << " component " << k;
+    }
+  }
+}
+
+TEST(PoseCompose, VectorMatchesScalar) {
+  size_t shapeCount = 1003;
+  size_t bodyCount = 300;
+  auto bodyPoses = randomPoses(bodyCount, 3);
+  auto localPoses = randomPoses(shapeCount, 4);
+  auto bodies = shapeBodies(shapeCount, bodyCount);
+
+  std::vector<float> scalar(7 * shapeCount);
+  composeShapePosesScalar(bodyPoses.data(), bodies.data(), localPoses.data(), shapeCount, 0,
+                          scalar.data());
+  std::vector<float> dispatched(7 * shapeCount);
+  composeShapePoses(bodyPoses.data(), bodies.data(), localPoses.data(), shapeCount,
+                    dispatched.data());
+  EXPECT_EQ(std::memcmp(scalar.data(), dispatched.data(), scalar.size() * sizeof(float)), 0);
+}
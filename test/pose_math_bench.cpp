@@ -0,0 +1,37 @@
+#include "pose_math.h"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using namespace sapien::render_server;
+
+static PoseBatch makePoses(size_t count) {
+  PoseBatch poses;
+  for (size_t i = 0; i < count; ++i) {
+    float pose[7] = {0.01f * i, 1.f, 2.f, 0.5f, 0.5f, 0.5f, 0.5f};
+    poses.push(pose, glm::vec3{1.f, 2.f, 3.f});
+  }
+  return poses;
+}
+
+static void BM_PosesToMatricesScalar(benchmark::State &state) {
+  auto poses = makePoses(state.range(0));
+  std::vector<glm::mat4> matrices(poses.size());
+  for (auto _ : state) {
+    posesToMatricesScalar(poses, 0, poses.size(), matrices.data());
+    benchmark::DoNotOptimize(matrices.data());
+  }
+  state.SetItemsProcessed(state.iterations() * poses.size());
+}
+BENCHMARK(BM_PosesToMatricesScalar)->Arg(1000)->Arg(10000)->Arg(100000);
+
+// SIMD when the CPU supports it
+static void BM_PosesToMatrices(benchmark::State &state) {
+  auto poses = makePoses(state.range(0));
+  std::vector<glm::mat4> matrices(poses.size());
+  for (auto _ : state) {
+    posesToMatrices(poses, matrices.data());
+    benchmark::DoNotOptimize(matrices.data());
+  }
+  state.SetItemsProcessed(state.iterations() * poses.size());
+}
+BENCHMARK(BM_PosesToMatrices)->Arg(1000)->Arg(10000)->Arg(100000);
@@ -0,0 +1,110 @@
+#include "pose_math.h"
+#include <cmath>
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace sapien::render_server;
+
+static PoseBatch randomPoses(size_t count, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> position(-10.f, 10.f);
+  std::uniform_real_distribution<float> scale(0.1f, 3.f);
+  std::normal_distribution<float> normal;
+
+  PoseBatch poses;
+  for (size_t i = 0; i < count; ++i) {
+    float pose[7] = {position(rng), position(rng), position(rng),
+                     normal(rng),   normal(rng),   normal(rng),   normal(rng)};
+    float norm = std::sqrt(pose[3] * pose[3] + pose[4] * pose[4] + pose[5] * pose[5] +
+                           pose[6] * pose[6]);
+    for (int k = 3; k < 7; ++k) {
+      pose[k] /= norm;
+    }
+    poses.push(pose, glm::vec3{scale(rng), scale(rng), scale(rng)});
+  }
+  return poses;
+}
+
+// rotate v by unit quaternion (w, x, y, z) as q v q*, independent of the matrix formula
+static void rotate(float w, float x, float y, float z, float const *v, float *out) {
+  // t = 2 cross(q.xyz, v); out = v + w t + cross(q.xyz, t)
+  float t[3] = {2.f * (y * v[2] - z * v[1]), 2.f * (z * v[0] - x * v[2]),
+                2.f * (x * v[1] - y * v[0])};
+  out[0] = v[0] + w * t[0] + (y * t[2] - z * t[1]);
+  out[1] = v[1] + w * t[1] + (z * t[0] - x * t[2]);
+  out[2] = v[2] + w * t[2] + (x * t[1] - y * t[0]);
+}
+
+static void expectMatrix(PoseBatch const &poses, size_t i, glm::mat4 &m) {
+  float scale[3] = {poses.sx[i], poses.sy[i], poses.sz[i]};
+  for (int c = 0; c < 3; ++c) {
+    float axis[3] = {0.f, 0.f, 0.f};
+    axis[c] = 1.f;
+    float column[3];
+    rotate(poses.qw[i], poses.qx[i], poses.qy[i], poses.qz[i], axis, column);
+    for (int r = 0; r < 3; ++r) {
+      ASSERT_NEAR(m[c][r], column[r] * scale[c], 1e-5f) << "pose " << i;
+    }
+    ASSERT_EQ(m[c][3], 0.f);
+  }
+  ASSERT_EQ(m[3][0], poses.px[i]);
+  ASSERT_EQ(m[3][1], poses.py[i]);
+  ASSERT_EQ(m[3][2], poses.pz[i]);
+  ASSERT_EQ(m[3][3], 1.f);
+}
+
+TEST(PoseMath, ScalarMatchesRotation) {
+  auto poses = randomPoses(100, 1);
+  std::vector<glm::mat4> matrices(poses.size());
+  posesToMatricesScalar(poses, 0, poses.size(), matrices.data());
+  for (size_t i = 0; i < poses.size(); ++i) {
+    expectMatrix(poses, i, matrices[i]);
+  }
+}
+
+// the dispatched path converts in SIMD batches with a scalar tail, 1003 leaves a tail of 3
+TEST(PoseMath, BatchMatchesRotation) {
+  auto poses = randomPoses(1003, 2);
+  std::vector<glm::mat4> matrices(poses.size());
+  posesToMatrices(poses, matrices.data());
+  for (size_t i = 0; i < poses.size(); ++i) {
+    expectMatrix(poses, i, matrices[i]);
+  }
+}
+
+// chunks of a parallel update start at arbitrary offsets and must leave the rest untouched
+TEST(PoseMath, SubrangeOnly) {
+  auto poses = randomPoses(64, 3);
+  std::vector<glm::mat4> matrices(poses.size());
+  for (auto &m : matrices) {
+    m[0][0] = -100.f;
+  }
+  posesToMatrices(poses, 5, 30, matrices.data());
+  for (size_t i = 0; i < poses.size(); ++i) {
+    if (i >= 5 && i < 30) {
+      expectMatrix(poses, i, matrices[i]);
+    } else {
+      EXPECT_EQ(matrices[i][0][0], -100.f) << "pose " << i;
+    }
+  }
+}
+
+#ifdef SAPIEN_RENDER_SERVER_X86
+TEST(PoseMath, AVX2MatchesScalar) {
+  if (!__builtin_cpu_supports("avx2") || !__builtin_cpu_supports("fma")) {
+    GTEST_SKIP() << "no AVX2";
+  }
+  auto poses = randomPoses(1027, 4);
+  std::vector<glm::mat4> scalar(poses.size()), simd(poses.size());
+  posesToMatricesScalar(poses, 0, poses.size(), scalar.data());
+  size_t end = posesToMatricesAVX2(poses, 3, poses.size(), simd.data());
+  EXPECT_EQ(end, 3 + (poses.size() - 3) / 8 * 8);
+  for (size_t i = 3; i < end; ++i) {
+    for (int c = 0; c < 4; ++c) {
+      for (int r = 0; r < 4; ++r) {
+        ASSERT_NEAR(simd[i][c][r], scalar[i][c][r], 1e-6f) << "pose " << i;
+      }
+    }
+  }
+}
+#endif
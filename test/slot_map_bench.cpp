@@ -0,0 +1,56 @@
+#include "safe_map.h"
+#include "slot_map.h"
+#include <benchmark/benchmark.h>
+#include <memory>
+
+using namespace sapien::render_server;
+
+// scene lookups as the handlers do them, a SlotMap against the ts_unordered_map it replaced
+constexpr int kScenes = 1024;
+
+struct Scene {
+  uint64_t index;
+};
+
+static std::vector<uint64_t> const &slotMapHandles(SlotMap<std::shared_ptr<Scene>> &map) {
+  static std::vector<uint64_t> handles = [&]() {
+    std::vector<uint64_t> result;
+    for (uint64_t i = 0; i < kScenes; ++i) {
+      result.push_back(map.insert(std::make_shared<Scene>(Scene{i})));
+    }
+    return result;
+  }();
+  return handles;
+}
+
+static void BM_SlotMapGet(benchmark::State &state) {
+  static SlotMap<std::shared_ptr<Scene>> map(1);
+  auto const &handles = slotMapHandles(map);
+  uint64_t i = state.thread_index();
+  for (auto _ : state) {
+    // bound by reference, as the handlers do
+    auto &scene = map.get(handles[i++ % kScenes]);
+    benchmark::DoNotOptimize(scene->index);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SlotMapGet)->ThreadRange(1, 16);
+
+static void BM_SafeMapGet(benchmark::State &state) {
+  static ts_unordered_map<uint64_t, std::shared_ptr<Scene>> map;
+  static bool filled = []() {
+    for (uint64_t i = 0; i < kScenes; ++i) {
+      map.set(i + 1, std::make_shared<Scene>(Scene{i}));
+    }
+    return true;
+  }();
+  benchmark::DoNotOptimize(filled);
+  uint64_t i = state.thread_index();
+  for (auto _ : state) {
+    // copies the shared_ptr under a read lock, as the handlers did
+    auto scene = map.get(i++ % kScenes + 1);
+    benchmark::DoNotOptimize(scene->index);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SafeMapGet)->ThreadRange(1, 16);
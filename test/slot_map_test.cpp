@@ -0,0 +1,141 @@
+#include "slot_map.h"
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace sapien::render_server;
+
+TEST(SlotMap, InsertFind) {
+  SlotMap<int> map(1);
+  uint64_t a = map.insert(10);
+  uint64_t b = map.insert(20);
+  EXPECT_NE(a, 0u);
+  EXPECT_NE(a, b);
+  EXPECT_EQ(map.get(a), 10);
+  EXPECT_EQ(*map.find(b), 20);
+  EXPECT_EQ(map.size(), 2u);
+}
+
+TEST(SlotMap, ZeroTagRejected) { EXPECT_THROW(SlotMap<int>(0), std::invalid_argument); }
+
+TEST(SlotMap, TagsKeepMapsApart) {
+  SlotMap<int> scenes(1);
+  SlotMap<int> materials(2);
+  uint64_t scene = scenes.insert(1);
+  uint64_t material = materials.insert(2);
+  EXPECT_NE(scene, material);
+  EXPECT_EQ(materials.find(scene), nullptr);
+  EXPECT_EQ(scenes.find(material), nullptr);
+}
+
+TEST(SlotMap, StaleHandleRejected) {
+  SlotMap<int> map(1);
+  uint64_t a = map.insert(10);
+  EXPECT_TRUE(map.erase(a));
+  EXPECT_FALSE(map.erase(a));
+  EXPECT_EQ(map.find(a), nullptr);
+  EXPECT_THROW(map.get(a), std::out_of_range);
+
+  // the slot is reused with a new generation, the old handle stays invalid
+  uint64_t b = map.insert(30);
+  EXPECT_EQ(static_cast<uint32_t>(a), static_cast<uint32_t>(b));
+  EXPECT_NE(a, b);
+  EXPECT_EQ(map.find(a), nullptr);
+  EXPECT_EQ(map.get(b), 30);
+}
+
+TEST(SlotMap, OutOfRangeHandle) {
+  SlotMap<int> map(1);
+  map.insert(1);
+  EXPECT_EQ(map.find((uint64_t(1) << 56) | 12345678), nullptr);
+}
+
+TEST(SlotMap, EraseIfAndFlat) {
+  SlotMap<int> map(1);
+  for (int i = 0; i < 10; ++i) {
+    map.insert(i);
+  }
+  map.eraseIf([](int v) { return v % 2; });
+  auto flat = map.flat();
+  ASSERT_EQ(flat.size(), 5u);
+  for (auto &[handle, value] : flat) {
+    EXPECT_EQ(value % 2, 0);
+    EXPECT_EQ(map.get(handle), value);
+  }
+}
+
+TEST(SlotMap, LookupsDuringInserts) {
+  SlotMap<uint64_t> map(1);
+  std::vector<uint64_t> handles;
+  for (uint64_t i = 0; i < 1000; ++i) {
+    handles.push_back(map.insert(i));
+  }
+
+  // inserts past the first chunk allocate new chunks while readers look up the old entries
+  std::atomic<bool> stop{false};
+  std::atomic<uint64_t> mismatches{0};
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 4; ++t) {
+    readers.emplace_back([&]() {
+      while (!stop) {
+        for (uint64_t i = 0; i < handles.size(); ++i) {
+          auto value = map.find(handles[i]);
+          if (!value || *value != i) {
+            mismatches++;
+          }
+        }
+      }
+    });
+  }
+  for (uint64_t i = 0; i < 20000; ++i) {
+    map.insert(i);
+  }
+  stop = true;
+  for (auto &reader : readers) {
+    reader.join();
+  }
+  EXPECT_EQ(mismatches, 0u);
+  EXPECT_EQ(map.size(), 21000u);
+}
+
+TEST(SlotMap, CopySurvivesErase) {
+  SlotMap<std::shared_ptr<int>> map(1);
+  uint64_t a = map.insert(std::make_shared<int>(5));
+  auto copy = map.copy(a);
+  ASSERT_TRUE(copy);
+  map.eraseIf([](auto const &) { return true; });
+  EXPECT_EQ(**copy, 5);
+  EXPECT_FALSE(map.copy(a));
+}
+
+// copies race with eraseIf on other entries and on the copied one, as material lookups race with
+// RemoveBody of other scenes
+TEST(SlotMap, CopyConcurrentWithEraseIf) {
+  SlotMap<std::weak_ptr<int>> map(3);
+  std::vector<std::shared_ptr<int>> owners;
+  std::vector<uint64_t> handles;
+  for (int i = 0; i < 256; ++i) {
+    owners.push_back(std::make_shared<int>(i));
+    handles.push_back(map.insert(owners.back()));
+  }
+  std::atomic<bool> done{false};
+  std::thread reader([&]() {
+    while (!done) {
+      for (size_t i = 0; i < handles.size(); ++i) {
+        if (auto weak = map.copy(handles[i])) {
+          if (auto value = weak->lock()) {
+            ASSERT_EQ(*value, static_cast<int>(i));
+          }
+        }
+      }
+    }
+  });
+  for (size_t i = 0; i < owners.size(); ++i) {
+    owners[i].reset();
+    map.eraseIf([](auto const &value) { return value.expired(); });
+  }
+  done = true;
+  reader.join();
+  // the reader may have held the last entry alive through the last sweep
+  map.eraseIf([](auto const &value) { return value.expired(); });
+  EXPECT_EQ(map.size(), 0u);
+}
@@ -0,0 +1,96 @@
+"""Render throughput of one server for each set of camera render targets.
+
+Cameras that declare only depth or segmentation get the reduced shader packs the package
+registers, so those sets should render faster than color. Needs a GPU and SAPIEN:
+
+    python test/target_fps.py MESH [--scenes 16] [--size 256] [--frames 200]
+"""
+
+import argparse
+import os
+import time
+
+import sapien
+from sapien_render_server import (
+    RenderClientBodyComponent,
+    RenderClientCameraComponent,
+    RenderClientShapeTriangleMesh,
+    RenderClientSystem,
+    RenderServer,
+)
+
+TARGET_SETS = [
+    ["color", "depth", "segmentation"],
+    ["color"],
+    ["segmentation", "depth"],
+    ["segmentation"],
+    ["depth"],
+]
+
+
+def measure(targets, args, port):
+    address = f"localhost:{port}"
+    server = RenderServer()
+    server.start(address)
+
+    systems, cameras = [], []
+    for index in range(args.scenes):
+        system = RenderClientSystem(address, index)
+        scene = sapien.Scene([sapien.physx.PhysxCpuSystem(), system])
+
+        body = RenderClientBodyComponent()
+        body.attach(RenderClientShapeTriangleMesh(args.mesh))
+        entity = sapien.Entity()
+        entity.add_component(body)
+        scene.add_entity(entity)
+
+        camera = RenderClientCameraComponent(args.size, args.size, render_targets=targets)
+        focal = args.size / 2
+        camera.set_perspective_parameters(0.01, 10.0, focal, focal, focal, focal, 0.0)
+        entity = sapien.Entity()
+        entity.add_component(camera)
+        entity.set_pose(sapien.Pose([-2, 0, 0]))
+        scene.add_entity(entity)
+
+        systems.append(system)
+        cameras.append(camera)
+
+    server.auto_allocate_buffers(targets)
+
+    def render():
+        for system, camera in zip(systems, cameras):
+            system.update_render_and_take_pictures([camera])
+        server.wait_all()
+
+    for _ in range(10):
+        render()
+    start = time.perf_counter()
+    for _ in range(args.frames):
+        render()
+    elapsed = time.perf_counter() - start
+
+    systems.clear()
+    cameras.clear()
+    server.stop()
+    return args.frames * args.scenes / elapsed
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("mesh")
+    parser.add_argument("--scenes", type=int, default=16)
+    parser.add_argument("--size", type=int, default=256)
+    parser.add_argument("--frames", type=int, default=200)
+    parser.add_argument("--port", type=int, default=15000)
+    args = parser.parse_args()
+
+    RenderServer._set_shader_dir(
+        os.path.join(os.path.dirname(sapien.__file__), "vulkan_shader", "default")
+    )
+    for i, targets in enumerate(TARGET_SETS):
+        fps = measure(targets, args, args.port + i)
+        print(f"{'+'.join(targets):28s} {fps:10.1f} camera frames/s")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,94 @@
+#include "thread_pool.hpp"
+#include <gtest/gtest.h>
+
+using namespace sapien;
+
+TEST(WorkStealingThreadPool, ParallelForCoversEveryIndexOnce) {
+  WorkStealingThreadPool pool(4);
+  pool.init();
+  for (size_t count : {0, 1, 7, 1000, 1001}) {
+    std::vector<std::atomic<int>> hits(count);
+    pool.parallelFor(count, 64, [&](size_t begin, size_t end) {
+      EXPECT_LE(end - begin, 64u);
+      for (size_t i = begin; i < end; ++i) {
+        hits[i]++;
+      }
+    });
+    for (size_t i = 0; i < count; ++i) {
+      ASSERT_EQ(hits[i], 1) << "count " << count << " index " << i;
+    }
+  }
+}
+
+// render tasks run on the pool and call parallelFor themselves
+TEST(WorkStealingThreadPool, NestedParallelFor) {
+  WorkStealingThreadPool pool(2);
+  pool.init();
+  std::atomic<size_t> total{0};
+  std::vector<std::future<void>> futures;
+  for (int t = 0; t < 8; ++t) {
+    futures.push_back(pool.submit([&]() {
+      pool.parallelFor(1000, 10, [&](size_t begin, size_t end) { total += end - begin; });
+    }));
+  }
+  for (auto &future : futures) {
+    future.get();
+  }
+  EXPECT_EQ(total, 8000u);
+}
+
+TEST(SerialExecutor, RunsInOrder) {
+  WorkStealingThreadPool pool(4);
+  pool.init();
+  auto executor = std::make_shared<SerialExecutor>(pool);
+  std::vector<int> order;
+  std::vector<std::future<void>> futures;
+  for (int i = 0; i < 100; ++i) {
+    futures.push_back(executor->submit([&order, i]() { order.push_back(i); }));
+  }
+  for (auto &future : futures) {
+    future.get();
+  }
+  ASSERT_EQ(order.size(), 100u);
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(order[i], i);
+  }
+}
+
+// posts from several threads while workers steal, every task runs exactly once
+TEST(WorkStealingThreadPool, ConcurrentPostsAllRun) {
+  WorkStealingThreadPool pool(4);
+  pool.init();
+  constexpr int kPerThread = 20000;
+  std::atomic<int> runs{0};
+  std::vector<std::thread> posters;
+  for (int t = 0; t < 4; ++t) {
+    posters.emplace_back([&]() {
+      for (int i = 0; i < kPerThread; ++i) {
+        pool.post([&]() { runs++; });
+      }
+    });
+  }
+  for (auto &poster : posters) {
+    poster.join();
+  }
+  pool.shutdown();
+  EXPECT_EQ(runs, 4 * kPerThread);
+}
+
+// shutdown drains the queue, including tasks that queued tasks post
+TEST(WorkStealingThreadPool, ShutdownRunsQueuedTasks) {
+  WorkStealingThreadPool pool(1);
+  pool.init();
+  auto executor = std::make_shared<SerialExecutor>(pool);
+  std::atomic<int> runs{0};
+  std::promise<void> release;
+  auto blocked = release.get_future().share();
+  pool.post([blocked]() { blocked.wait(); });
+  for (int i = 0; i < 100; ++i) {
+    executor->submit([&]() { runs++; });
+  }
+  release.set_value();
+  pool.shutdown();
+  EXPECT_EQ(runs, 100);
+}
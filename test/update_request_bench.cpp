@@ -0,0 +1,42 @@
+#include "update_request.h"
+#include <benchmark/benchmark.h>
+#include <google/protobuf/arena.h>
+
+using namespace sapien::render_server;
+
+// Arena bytes a reused pipelined step request takes per step, clearing it with Message::Clear
+// against clearStepRequest. Arguments are the shape count and whether poses go through the pose
+// buffer (only pose_slot is set) or in the request.
+template <bool InPlace> static void BM_StepRequest(benchmark::State &state) {
+  int shapes = state.range(0);
+  bool poseSlot = state.range(1);
+  google::protobuf::Arena arena;
+  auto *req = google::protobuf::Arena::CreateMessage<proto::StepReq>(&arena);
+  uint64_t frame = 0;
+  size_t used = 0;
+  for (auto _ : state) {
+    if (InPlace) {
+      clearStepRequest(*req, poseSlot);
+    } else {
+      req->Clear();
+    }
+    req->set_frame(++frame);
+    auto &update = *req->mutable_update();
+    update.set_scene_id(1);
+    if (poseSlot) {
+      update.mutable_pose_slot()->set_frame(frame);
+    } else {
+      update.mutable_body_pose_data()->Resize(7 * shapes, 0.f);
+    }
+    benchmark::DoNotOptimize(req);
+
+    // the first step sizes the fields, later ones should take nothing
+    if (frame == 1) {
+      used = arena.SpaceUsed();
+    }
+  }
+  state.counters["arena_bytes_per_step"] =
+      benchmark::Counter(double(arena.SpaceUsed() - used) / std::max<uint64_t>(frame - 1, 1));
+}
+BENCHMARK_TEMPLATE(BM_StepRequest, false)->ArgsProduct({{5000}, {0, 1}});
+BENCHMARK_TEMPLATE(BM_StepRequest, true)->ArgsProduct({{5000}, {0, 1}});
@@ -0,0 +1,110 @@
+#include "update_request.h"
+#include <google/protobuf/arena.h>
+#include <gtest/gtest.h>
+
+using namespace sapien::render_server;
+
+constexpr int kShapes = 5000;
+constexpr int kSteps = 100;
+
+// what the client writes into an update each step, through the pose buffer or in the request
+template <typename Req> static void fillUpdate(Req &req, bool poseSlot, uint64_t frame) {
+  req.set_scene_id(1);
+  if (poseSlot) {
+    req.mutable_pose_slot()->set_frame(frame);
+    req.mutable_pose_slot()->set_slot(frame % 4);
+    return;
+  }
+  req.mutable_body_pose_data()->Resize(7 * kShapes, 0.f);
+  req.mutable_camera_pose_data()->Resize(7, 0.f);
+  req.mutable_body_pose_quantized()->resize(20 * kShapes);
+}
+
+// arena bytes taken by steps after the first, which sizes every field
+template <typename Step> static size_t bytesAfterFirstStep(Step step) {
+  google::protobuf::Arena arena;
+  step(arena, 0);
+  size_t used = arena.SpaceUsed();
+  for (int i = 1; i < kSteps; ++i) {
+    step(arena, i);
+  }
+  return arena.SpaceUsed() - used;
+}
+
+TEST(UpdateRequest, StepRequestIsReused) {
+  for (bool poseSlot : {false, true}) {
+    proto::StepReq *req = nullptr;
+    size_t bytes = bytesAfterFirstStep([&](google::protobuf::Arena &arena, uint64_t frame) {
+      if (!req) {
+        req = google::protobuf::Arena::CreateMessage<proto::StepReq>(&arena);
+      }
+      clearStepRequest(*req, poseSlot);
+      req->set_frame(frame);
+      fillUpdate(*req->mutable_update(), poseSlot, frame);
+    });
+    EXPECT_EQ(bytes, 0u) << "poseSlot " << poseSlot;
+  }
+}
+
+TEST(UpdateRequest, UpdateRenderRequestIsReused) {
+  for (bool poseSlot : {false, true}) {
+    proto::UpdateRenderReq *req = nullptr;
+    size_t bytes = bytesAfterFirstStep([&](google::protobuf::Arena &arena, uint64_t frame) {
+      if (!req) {
+        req = google::protobuf::Arena::CreateMessage<proto::UpdateRenderReq>(&arena);
+      }
+      clearUpdateRequest(*req, poseSlot);
+      fillUpdate(*req, poseSlot, frame);
+    });
+    EXPECT_EQ(bytes, 0u) << "poseSlot " << poseSlot;
+  }
+}
+
+TEST(UpdateRequest, BatchScenesAreReused) {
+  proto::BatchUpdateRenderAndTakePicturesReq *req = nullptr;
+  size_t bytes = bytesAfterFirstStep([&](google::protobuf::Arena &arena, uint64_t frame) {
+    if (!req) {
+      req = google::protobuf::Arena::CreateMessage<proto::BatchUpdateRenderAndTakePicturesReq>(
+          &arena);
+      for (int i = 0; i < 8; ++i) {
+        req->add_scenes();
+      }
+    }
+    for (auto &scene : *req->mutable_scenes()) {
+      clearUpdateRequest(scene, true);
+      fillUpdate(scene, true, frame);
+      scene.add_camera_ids(1);
+    }
+  });
+  EXPECT_EQ(bytes, 0u);
+}
+
+TEST(UpdateRequest, ClearEmptiesFields) {
+  google::protobuf::Arena arena;
+  auto *req = google::protobuf::Arena::CreateMessage<proto::StepReq>(&arena);
+  req->set_frame(3);
+  fillUpdate(*req->mutable_update(), true, 3);
+  fillUpdate(*req->mutable_update(), false, 3);
+
+  clearStepRequest(*req, true);
+  EXPECT_EQ(req->frame(), 0u);
+  EXPECT_EQ(req->update().scene_id(), 0u);
+  EXPECT_EQ(req->update().body_pose_data_size(), 0);
+  EXPECT_TRUE(req->update().body_pose_quantized().empty());
+  // kept for the next pose buffer update, but empty
+  ASSERT_TRUE(req->update().has_pose_slot());
+  EXPECT_EQ(req->update().pose_slot().frame(), 0u);
+
+  clearStepRequest(*req, false);
+  EXPECT_FALSE(req->update().has_pose_slot());
+}
+
+TEST(UpdateRequest, WorksWithoutArena) {
+  proto::UpdateRenderAndTakePicturesReq req;
+  fillUpdate(req, true, 1);
+  clearUpdateRequest(req, true);
+  ASSERT_TRUE(req.has_pose_slot());
+  EXPECT_EQ(req.pose_slot().frame(), 0u);
+  clearUpdateRequest(req, false);
+  EXPECT_FALSE(req.has_pose_slot());
+}
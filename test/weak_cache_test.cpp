@@ -0,0 +1,91 @@
+#include "weak_cache.h"
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace sapien::render_server;
+
+using Cache = WeakCache<std::string, int, int>;
+
+TEST(WeakCache, HitWhileAlive) {
+  Cache cache;
+  int loads = 0;
+  auto load = [&]() {
+    ++loads;
+    return std::make_shared<int>(7);
+  };
+  auto a = cache.get("a", 1, load);
+  auto b = cache.get("a", 1, load);
+  EXPECT_EQ(a, b);
+  EXPECT_EQ(loads, 1);
+  EXPECT_EQ(cache.getHitCount(), 1u);
+  EXPECT_EQ(cache.getMissCount(), 1u);
+  EXPECT_EQ(cache.size(), 1u);
+}
+
+TEST(WeakCache, FreedWithLastUser) {
+  Cache cache;
+  int loads = 0;
+  auto load = [&]() {
+    ++loads;
+    return std::make_shared<int>(7);
+  };
+  auto a = cache.get("a", 1, load);
+  std::weak_ptr<int> weak = a;
+  auto b = cache.get("a", 1, load);
+  a.reset();
+  EXPECT_FALSE(weak.expired());
+  b.reset();
+  EXPECT_TRUE(weak.expired());
+  EXPECT_EQ(cache.size(), 0u);
+
+  cache.get("a", 1, load);
+  EXPECT_EQ(loads, 2);
+}
+
+TEST(WeakCache, NewVersionReloads) {
+  Cache cache;
+  auto a = cache.get("a", 1, []() { return std::make_shared<int>(1); });
+  auto b = cache.get("a", 2, []() { return std::make_shared<int>(2); });
+  EXPECT_EQ(*a, 1);
+  EXPECT_EQ(*b, 2);
+  EXPECT_EQ(cache.getMissCount(), 2u);
+  EXPECT_EQ(cache.size(), 1u);
+}
+
+TEST(WeakCache, FailedLoadIsRetried) {
+  Cache cache;
+  EXPECT_THROW(cache.get("a", 1, []() -> std::shared_ptr<int> { throw std::runtime_error("x"); }),
+               std::runtime_error);
+  EXPECT_EQ(cache.size(), 0u);
+  auto a = cache.get("a", 1, []() { return std::make_shared<int>(3); });
+  EXPECT_EQ(*a, 3);
+}
+
+TEST(WeakCache, ConcurrentRequestsShareOneLoad) {
+  Cache cache;
+  std::atomic<int> loads{0};
+  std::vector<std::shared_ptr<int>> values(8);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < values.size(); ++i) {
+    threads.emplace_back([&, i]() {
+      values[i] = cache.get("a", 1, [&]() {
+        ++loads;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        return std::make_shared<int>(5);
+      });
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  // all threads hold the value, so no request could have found it freed
+  EXPECT_EQ(loads, 1);
+  for (auto &value : values) {
+    EXPECT_EQ(value, values[0]);
+  }
+}